@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "core/batch/include/batch_runner.hpp"
+#include "core/batch/include/pipelined_executor.hpp"
+#include "core/task/func_tests/test_task.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+struct Instance {
+  std::vector<int32_t> in;
+  std::vector<int32_t> out;
+  ppc::core::TaskDataPtr task_data;
+};
+
+std::vector<Instance> MakeInstances(size_t count) {
+  std::vector<Instance> instances(count);
+  for (size_t i = 0; i < count; i++) {
+    auto &instance = instances[i];
+    instance.in.assign(i + 1, 1);
+    instance.out.assign(1, 0);
+    instance.task_data = std::make_shared<ppc::core::TaskData>();
+    instance.task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(instance.in.data()));
+    instance.task_data->inputs_count.emplace_back(instance.in.size());
+    instance.task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(instance.out.data()));
+    instance.task_data->outputs_count.emplace_back(instance.out.size());
+  }
+  return instances;
+}
+
+std::vector<ppc::core::TaskDataPtr> GetBatch(const std::vector<Instance> &instances) {
+  std::vector<ppc::core::TaskDataPtr> batch;
+  batch.reserve(instances.size());
+  for (const auto &instance : instances) {
+    batch.push_back(instance.task_data);
+  }
+  return batch;
+}
+
+// Tracks maximal count of instances which are running at the same time
+class ConcurrencyTrackingTask : public ppc::test::task::TestTask<int32_t> {
+ public:
+  ConcurrencyTrackingTask(const ppc::core::TaskDataPtr &task_data, std::atomic<int> &active, std::atomic<int> &peak)
+      : TestTask<int32_t>(task_data), active_(active), peak_(peak) {}
+
+  bool RunImpl() override {
+    int now = ++active_;
+    int prev = peak_.load();
+    while (prev < now && !peak_.compare_exchange_weak(prev, now)) {
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    --active_;
+    return TestTask<int32_t>::RunImpl();
+  }
+
+ private:
+  std::atomic<int> &active_;
+  std::atomic<int> &peak_;
+};
+
+// Counts PreProcessing calls which happen while Run of other instance is in progress
+class OverlapTrackingTask : public ppc::test::task::TestTask<int32_t> {
+ public:
+  OverlapTrackingTask(const ppc::core::TaskDataPtr &task_data, std::atomic<int> &running, std::atomic<int> &overlaps)
+      : TestTask<int32_t>(task_data), running_(running), overlaps_(overlaps) {}
+
+  bool PreProcessingImpl() override {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    if (running_.load() > 0) {
+      overlaps_++;
+    }
+    return TestTask<int32_t>::PreProcessingImpl();
+  }
+
+  bool RunImpl() override {
+    running_++;
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    running_--;
+    return TestTask<int32_t>::RunImpl();
+  }
+
+ private:
+  std::atomic<int> &running_;
+  std::atomic<int> &overlaps_;
+};
+
+template <class T>
+class ThrowingTask : public ppc::test::task::TestTask<T> {
+ public:
+  explicit ThrowingTask(const ppc::core::TaskDataPtr &task_data) : ppc::test::task::TestTask<T>(task_data) {}
+  bool RunImpl() override { throw std::runtime_error("run error"); }
+};
+
+}  // namespace
+
+TEST(batch_tests, check_batch_results) {
+  auto instances = MakeInstances(200);
+  ppc::core::BatchAttr attr;
+  attr.max_concurrency = 4;
+  ppc::core::BatchRunner runner(
+      [](ppc::core::TaskDataPtr task_data) { return std::make_shared<ppc::test::task::TestTask<int32_t>>(task_data); },
+      attr);
+  auto results = runner.Run(GetBatch(instances));
+
+  EXPECT_EQ(results.num_instances, 200U);
+  EXPECT_EQ(results.num_failed, 0U);
+  EXPECT_EQ(results.concurrency, 4U);
+  EXPECT_EQ(results.input_size, 200U * 201U / 2U);
+  EXPECT_GT(results.instances_per_sec, 0.0);
+  for (size_t i = 0; i < instances.size(); i++) {
+    EXPECT_EQ(instances[i].out[0], static_cast<int32_t>(i + 1));
+  }
+}
+
+TEST(batch_tests, check_reuse_tasks) {
+  auto instances = MakeInstances(50);
+  std::atomic<int> created{0};
+  ppc::core::BatchAttr attr;
+  attr.max_concurrency = 2;
+  attr.reuse_tasks = true;
+  ppc::core::BatchRunner runner(
+      [&](ppc::core::TaskDataPtr task_data) {
+        created++;
+        return std::make_shared<ppc::test::task::ReusableTestTask<int32_t>>(task_data);
+      },
+      attr);
+  auto results = runner.Run(GetBatch(instances));
+
+  EXPECT_EQ(results.num_failed, 0U);
+  EXPECT_LE(created.load(), 2);
+  for (size_t i = 0; i < instances.size(); i++) {
+    EXPECT_EQ(instances[i].out[0], static_cast<int32_t>(i + 1));
+  }
+}
+
+TEST(batch_tests, check_bounded_concurrency) {
+  auto instances = MakeInstances(32);
+  std::atomic<int> active{0};
+  std::atomic<int> peak{0};
+  ppc::core::BatchAttr attr;
+  attr.max_concurrency = 3;
+  ppc::core::BatchRunner runner(
+      [&](ppc::core::TaskDataPtr task_data) {
+        return std::make_shared<ConcurrencyTrackingTask>(task_data, active, peak);
+      },
+      attr);
+  auto results = runner.Run(GetBatch(instances));
+
+  EXPECT_EQ(results.num_failed, 0U);
+  EXPECT_LE(peak.load(), 3);
+  EXPECT_GE(peak.load(), 1);
+}
+
+TEST(batch_tests, check_failed_instances) {
+  auto instances = MakeInstances(10);
+  // Validation of test task requires single output
+  instances[3].task_data->outputs_count[0] = 2;
+  ppc::core::BatchAttr attr;
+  attr.max_concurrency = 2;
+  ppc::core::BatchRunner runner(
+      [](ppc::core::TaskDataPtr task_data) {
+        if (task_data->inputs_count[0] == 6) {
+          throw std::runtime_error("factory error");
+        }
+        return std::make_shared<ppc::test::task::TestTask<int32_t>>(task_data);
+      },
+      attr);
+  auto results = runner.Run(GetBatch(instances));
+
+  EXPECT_EQ(results.num_failed, 2U);
+  EXPECT_EQ(results.errors[3], "Validation failed");
+  EXPECT_EQ(results.errors[5], "factory error");
+  EXPECT_EQ(instances[9].out[0], 10);
+}
+
+TEST(batch_tests, check_empty_batch) {
+  ppc::core::BatchRunner runner(
+      [](ppc::core::TaskDataPtr task_data) { return std::make_shared<ppc::test::task::TestTask<int32_t>>(task_data); });
+  auto results = runner.Run({});
+  EXPECT_EQ(results.num_instances, 0U);
+  EXPECT_EQ(results.num_failed, 0U);
+}
+
+TEST(batch_tests, check_run_async) {
+  auto instances = MakeInstances(3);
+  auto future = ppc::core::RunAsync(std::make_shared<ppc::test::task::TestTask<int32_t>>(instances[2].task_data));
+  EXPECT_TRUE(future.get());
+  EXPECT_EQ(instances[2].out[0], 3);
+
+  auto failed = ppc::core::RunAsync(std::make_shared<ThrowingTask<int32_t>>(instances[1].task_data));
+  EXPECT_THROW(failed.get(), std::runtime_error);
+}
+
+TEST(batch_tests, check_pipelined_executor) {
+  for (bool reuse_tasks : {false, true}) {
+    auto instances = MakeInstances(100);
+    instances[7].task_data->outputs_count[0] = 2;
+    std::atomic<int> created{0};
+    ppc::core::PipelineAttr attr;
+    attr.reuse_tasks = reuse_tasks;
+    ppc::core::PipelinedExecutor executor(
+        [&](ppc::core::TaskDataPtr task_data) {
+          created++;
+          return std::make_shared<ppc::test::task::ReusableTestTask<int32_t>>(task_data);
+        },
+        attr);
+    auto results = executor.Run(GetBatch(instances));
+
+    EXPECT_EQ(results.num_instances, 100U);
+    EXPECT_EQ(results.num_failed, 1U);
+    EXPECT_EQ(results.errors[7], "Validation failed");
+    for (size_t i = 0; i < instances.size(); i++) {
+      if (i != 7) {
+        EXPECT_EQ(instances[i].out[0], static_cast<int32_t>(i + 1));
+      }
+    }
+    // Tasks in flight: one per stage and queued ones
+    if (reuse_tasks) {
+      EXPECT_LE(created.load(), 10);
+    } else {
+      EXPECT_EQ(created.load(), 100);
+    }
+  }
+}
+
+TEST(batch_tests, check_pipelined_executor_overlaps_phases) {
+  auto instances = MakeInstances(20);
+  std::atomic<int> running{0};
+  std::atomic<int> overlaps{0};
+  ppc::core::PipelinedExecutor executor([&](ppc::core::TaskDataPtr task_data) {
+    return std::make_shared<OverlapTrackingTask>(task_data, running, overlaps);
+  });
+  auto results = executor.Run(GetBatch(instances));
+
+  EXPECT_EQ(results.num_failed, 0U);
+  EXPECT_GT(overlaps.load(), 0);
+  EXPECT_EQ(instances[19].out[0], 20);
+}
+
+TEST(batch_tests, check_pipelined_executor_run_error) {
+  auto instances = MakeInstances(5);
+  ppc::core::PipelinedExecutor executor(
+      [](ppc::core::TaskDataPtr task_data) { return std::make_shared<ThrowingTask<int32_t>>(task_data); });
+  auto results = executor.Run(GetBatch(instances));
+  EXPECT_EQ(results.num_failed, 5U);
+  EXPECT_EQ(results.errors[0], "run error");
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// Creates task for given data, e.g. [](TaskDataPtr data) { return std::make_shared<MyTaskSequential>(data); }
+using TaskFactory = std::function<std::shared_ptr<Task>(TaskDataPtr)>;
+
+struct BatchAttr {
+  // count of instances executed at the same time, 0 means PPC_NUM_THREADS
+  size_t max_concurrency = 0;
+  // each worker creates one task and rebinds it to next instances instead of creating task per instance
+  bool reuse_tasks = false;
+};
+
+struct BatchResults {
+  // wall time of whole batch (in seconds)
+  double time_sec = 0.0;
+  // count of instances executed at the same time
+  size_t concurrency = 0;
+  uint64_t num_instances = 0;
+  uint64_t num_failed = 0;
+  // per instance: empty if pipeline succeeded, otherwise failed phase or exception message
+  std::vector<std::string> errors;
+  // per instance: time of full pipeline (in seconds)
+  std::vector<double> instance_time_sec;
+  // sum of inputs_count over all instances
+  uint64_t input_size = 0;
+  // aggregate throughput
+  double instances_per_sec = 0.0;
+  double elements_per_sec = 0.0;
+};
+
+// Runs full pipeline of tasks over many independent instances of data, instances are processed in parallel
+class BatchRunner {
+ public:
+  explicit BatchRunner(TaskFactory factory, BatchAttr attr = {});
+  [[nodiscard]] BatchResults Run(const std::vector<TaskDataPtr> &batch) const;
+
+ private:
+  TaskFactory factory_;
+  BatchAttr attr_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "core/batch/include/batch_runner.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// Runs full pipeline of task on separate thread, result is false if some phase failed.
+// Task must not be used by caller until future is ready, exceptions of phases are rethrown by future.get()
+std::future<bool> RunAsync(std::shared_ptr<Task> task);
+
+struct PipelineAttr {
+  // count of preprocessed instances waiting for Run (and of finished runs waiting for PostProcessing)
+  size_t queue_depth = 2;
+  // tasks which finished PostProcessing are rebound to next instances instead of creating new ones
+  bool reuse_tasks = false;
+};
+
+// Executes instances in three overlapping stages on separate threads:
+//   Validation + PreProcessing of instance N+1 | Run of instance N | PostProcessing of instance N-1
+// so copy-in/copy-out of throughput-bound batches is hidden behind computations
+class PipelinedExecutor {
+ public:
+  explicit PipelinedExecutor(TaskFactory factory, PipelineAttr attr = {});
+  [[nodiscard]] BatchResults Run(const std::vector<TaskDataPtr> &batch) const;
+
+ private:
+  TaskFactory factory_;
+  PipelineAttr attr_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,110 @@
+#include "core/batch/include/batch_runner.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+double SecondsSince(std::chrono::steady_clock::time_point begin) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+// Returns empty string if all phases succeeded
+std::string RunPipeline(ppc::core::Task &task) {
+  if (!task.Validation()) {
+    return "Validation failed";
+  }
+  if (!task.PreProcessing()) {
+    return "PreProcessing failed";
+  }
+  if (!task.Run()) {
+    return "Run failed";
+  }
+  if (!task.PostProcessing()) {
+    return "PostProcessing failed";
+  }
+  return {};
+}
+
+}  // namespace
+
+ppc::core::BatchRunner::BatchRunner(TaskFactory factory, BatchAttr attr)
+    : factory_(std::move(factory)), attr_(attr) {}
+
+ppc::core::BatchResults ppc::core::BatchRunner::Run(const std::vector<TaskDataPtr> &batch) const {
+  BatchResults results;
+  size_t num_instances = batch.size();
+  results.num_instances = num_instances;
+  results.errors.resize(num_instances);
+  results.instance_time_sec.resize(num_instances);
+  for (const auto &task_data : batch) {
+    for (auto count : task_data->inputs_count) {
+      results.input_size += count;
+    }
+  }
+
+  size_t concurrency = attr_.max_concurrency > 0 ? attr_.max_concurrency
+                                                 : static_cast<size_t>(std::max(ppc::util::GetPPCNumThreads(), 1));
+  concurrency = std::max<size_t>(std::min(concurrency, num_instances), 1);
+  results.concurrency = concurrency;
+
+  // Instances are taken dynamically one by one, so uneven instances don't leave workers idle
+  std::atomic<size_t> next_instance{0};
+  auto worker = [&] {
+    std::shared_ptr<Task> task;
+    for (size_t i = next_instance.fetch_add(1); i < num_instances; i = next_instance.fetch_add(1)) {
+      auto begin = std::chrono::steady_clock::now();
+      try {
+        if (task && attr_.reuse_tasks) {
+          task->Rebind(batch[i]);
+        } else {
+          task = factory_(batch[i]);
+          // Instances are checked as a whole batch, not by time limit of single functional test
+          task->GetData()->state_of_testing = TaskData::StateOfTesting::kPerf;
+        }
+        results.errors[i] = RunPipeline(*task);
+      } catch (const std::exception &e) {
+        results.errors[i] = e.what();
+        task.reset();
+      } catch (...) {
+        results.errors[i] = "Unknown exception";
+        task.reset();
+      }
+      results.instance_time_sec[i] = SecondsSince(begin);
+    }
+  };
+
+  auto begin = std::chrono::steady_clock::now();
+  if (concurrency == 1) {
+    worker();
+  } else {
+    std::vector<std::thread> threads;
+    threads.reserve(concurrency);
+    for (size_t i = 0; i < concurrency; i++) {
+      threads.emplace_back(worker);
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+  results.time_sec = SecondsSince(begin);
+
+  results.num_failed = std::ranges::count_if(results.errors, [](const std::string &error) { return !error.empty(); });
+  if (results.time_sec > 0.0) {
+    results.instances_per_sec = static_cast<double>(num_instances) / results.time_sec;
+    results.elements_per_sec = static_cast<double>(results.input_size) / results.time_sec;
+  }
+  return results;
+}
@@ -0,0 +1,192 @@
+#include "core/batch/include/pipelined_executor.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/batch/include/batch_runner.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+// Blocking queue between two stages, Push waits while queue is full
+template <class T>
+class BoundedQueue {
+ public:
+  explicit BoundedQueue(size_t capacity) : capacity_(std::max<size_t>(capacity, 1)) {}
+
+  void Push(T item) {
+    std::unique_lock lock(mutex_);
+    not_full_.wait(lock, [&] { return items_.size() < capacity_; });
+    items_.push_back(std::move(item));
+    not_empty_.notify_one();
+  }
+
+  // Returns nothing when queue is closed and empty
+  std::optional<T> Pop() {
+    std::unique_lock lock(mutex_);
+    not_empty_.wait(lock, [&] { return !items_.empty() || closed_; });
+    if (items_.empty()) {
+      return std::nullopt;
+    }
+    T item = std::move(items_.front());
+    items_.pop_front();
+    not_full_.notify_one();
+    return item;
+  }
+
+  void Close() {
+    std::lock_guard lock(mutex_);
+    closed_ = true;
+    not_empty_.notify_all();
+  }
+
+ private:
+  size_t capacity_;
+  std::deque<T> items_;
+  bool closed_ = false;
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+};
+
+struct StageItem {
+  size_t index;
+  std::shared_ptr<ppc::core::Task> task;
+  // false if previous stage failed, following stages only pass item through
+  bool ok;
+};
+
+// Runs phase and stores failure of instance, returns false on failure
+bool RunPhase(const std::function<bool()> &phase, const char *name, std::string &error) {
+  try {
+    if (!phase()) {
+      error = std::string(name) + " failed";
+      return false;
+    }
+  } catch (const std::exception &e) {
+    error = e.what();
+    return false;
+  } catch (...) {
+    error = "Unknown exception";
+    return false;
+  }
+  return true;
+}
+
+double SecondsBetween(std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end) {
+  return std::chrono::duration<double>(end - begin).count();
+}
+
+}  // namespace
+
+std::future<bool> ppc::core::RunAsync(std::shared_ptr<Task> task) {
+  return std::async(std::launch::async, [task = std::move(task)] {
+    return task->Validation() && task->PreProcessing() && task->Run() && task->PostProcessing();
+  });
+}
+
+ppc::core::PipelinedExecutor::PipelinedExecutor(TaskFactory factory, PipelineAttr attr)
+    : factory_(std::move(factory)), attr_(attr) {}
+
+ppc::core::BatchResults ppc::core::PipelinedExecutor::Run(const std::vector<TaskDataPtr> &batch) const {
+  constexpr size_t kNumStages = 3;
+  BatchResults results;
+  size_t num_instances = batch.size();
+  results.num_instances = num_instances;
+  results.concurrency = kNumStages;
+  results.errors.resize(num_instances);
+  results.instance_time_sec.resize(num_instances);
+  for (const auto &task_data : batch) {
+    for (auto count : task_data->inputs_count) {
+      results.input_size += count;
+    }
+  }
+  std::vector<std::chrono::steady_clock::time_point> instance_begin(num_instances);
+
+  BoundedQueue<StageItem> to_run(attr_.queue_depth);
+  BoundedQueue<StageItem> to_post_process(attr_.queue_depth);
+  std::mutex free_tasks_mutex;
+  std::vector<std::shared_ptr<Task>> free_tasks;
+
+  auto run_stage = [&] {
+    while (auto item = to_run.Pop()) {
+      if (item->ok) {
+        item->ok = RunPhase([&] { return item->task->Run(); }, "Run", results.errors[item->index]);
+      }
+      to_post_process.Push(std::move(*item));
+    }
+    to_post_process.Close();
+  };
+
+  auto post_processing_stage = [&] {
+    while (auto item = to_post_process.Pop()) {
+      if (item->ok) {
+        item->ok = RunPhase([&] { return item->task->PostProcessing(); }, "PostProcessing",
+                            results.errors[item->index]);
+      }
+      results.instance_time_sec[item->index] =
+          SecondsBetween(instance_begin[item->index], std::chrono::steady_clock::now());
+      // Task is returned for reuse only if its pipeline is completed
+      if (item->ok && attr_.reuse_tasks) {
+        std::lock_guard lock(free_tasks_mutex);
+        free_tasks.push_back(std::move(item->task));
+      }
+    }
+  };
+
+  auto begin = std::chrono::steady_clock::now();
+  std::thread run_thread(run_stage);
+  std::thread post_processing_thread(post_processing_stage);
+
+  // Validation and PreProcessing are executed by calling thread
+  for (size_t i = 0; i < num_instances; i++) {
+    instance_begin[i] = std::chrono::steady_clock::now();
+    StageItem item{.index = i, .task = nullptr, .ok = true};
+    {
+      std::lock_guard lock(free_tasks_mutex);
+      if (!free_tasks.empty()) {
+        item.task = std::move(free_tasks.back());
+        free_tasks.pop_back();
+      }
+    }
+    item.ok = RunPhase(
+        [&] {
+          if (item.task) {
+            item.task->Rebind(batch[i]);
+          } else {
+            item.task = factory_(batch[i]);
+            // Instances are checked as a whole batch, not by time limit of single functional test
+            item.task->GetData()->state_of_testing = TaskData::StateOfTesting::kPerf;
+          }
+          return item.task->Validation();
+        },
+        "Validation", results.errors[i]);
+    item.ok = item.ok && RunPhase([&] { return item.task->PreProcessing(); }, "PreProcessing", results.errors[i]);
+    to_run.Push(std::move(item));
+  }
+  to_run.Close();
+
+  run_thread.join();
+  post_processing_thread.join();
+  results.time_sec = SecondsBetween(begin, std::chrono::steady_clock::now());
+
+  results.num_failed = std::ranges::count_if(results.errors, [](const std::string &error) { return !error.empty(); });
+  if (results.time_sec > 0.0) {
+    results.instances_per_sec = static_cast<double>(num_instances) / results.time_sec;
+    results.elements_per_sec = static_cast<double>(results.input_size) / results.time_sec;
+  }
+  return results;
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "core/gen/include/gen.hpp"
+
+TEST(gen_tests, splitmix_matches_sequential_splitmix64) {
+  // Reference values of SplitMix64 seeded with 1234567
+  uint64_t state = 1234567;
+  for (uint64_t counter = 0; counter < 3; counter++) {
+    state += ppc::gen::SplitMix::kGamma;
+    EXPECT_EQ(ppc::gen::SplitMix::Bits(1234567, counter), ppc::gen::SplitMix::Mix(state));
+  }
+  EXPECT_EQ(ppc::gen::SplitMix::Bits(1234567, 0), 6457827717110365317ULL);
+  EXPECT_EQ(ppc::gen::SplitMix::Bits(1234567, 1), 3203168211198807973ULL);
+}
+
+TEST(gen_tests, philox_known_answer) {
+  // Counter and key words of zeros give first output words of Random123 test vector for Philox4x32-10
+  EXPECT_EQ(ppc::gen::Philox::Bits(0, 0), (uint64_t{0x6627e8d5} << 32) | 0xe169c58dULL);
+}
+
+TEST(gen_tests, same_seed_same_values) {
+  auto a = ppc::gen::UniformVector<double>(100000, -1.0, 1.0, 42);
+  auto b = ppc::gen::UniformVector<double>(100000, -1.0, 1.0, 42);
+  auto c = ppc::gen::UniformVector<double>(100000, -1.0, 1.0, 43);
+  auto d = ppc::gen::UniformVector<double>(100000, -1.0, 1.0, 42, 1);
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+  EXPECT_NE(a, d);
+}
+
+TEST(gen_tests, parallel_fill_matches_sequential_values) {
+  // Every element of parallel fill is the value addressed by its index, so chunking of workers can't change it
+  std::vector<int> parallel = ppc::gen::UniformVector<int>(300000, -5, 5, 7);
+  ppc::gen::Random<> rng(7);
+  for (size_t i = 0; i < parallel.size(); i++) {
+    ASSERT_EQ(parallel[i], rng.Uniform(i, -5, 5));
+  }
+}
+
+TEST(gen_tests, uniform_int_covers_closed_range) {
+  auto data = ppc::gen::UniformVector<int>(100000, -3, 3, 1);
+  EXPECT_EQ(*std::ranges::min_element(data), -3);
+  EXPECT_EQ(*std::ranges::max_element(data), 3);
+  auto bytes = ppc::gen::UniformVector<uint8_t, ppc::gen::Philox>(10000, 0, 255, 1);
+  EXPECT_EQ(*std::ranges::max_element(bytes), 255);
+}
+
+TEST(gen_tests, uniform_double_moments) {
+  auto data = ppc::gen::UniformMatrix<double>(500, 400, 2.0, 4.0, 5);
+  ASSERT_EQ(data.size(), 200000U);
+  EXPECT_GE(*std::ranges::min_element(data), 2.0);
+  EXPECT_LT(*std::ranges::max_element(data), 4.0);
+  double mean = std::accumulate(data.begin(), data.end(), 0.0) / static_cast<double>(data.size());
+  EXPECT_NEAR(mean, 3.0, 0.01);
+}
+
+TEST(gen_tests, normal_moments) {
+  auto data = ppc::gen::NormalVector(200000, 1.0, 2.0, 9);
+  double mean = std::accumulate(data.begin(), data.end(), 0.0) / static_cast<double>(data.size());
+  double var = 0.0;
+  for (double x : data) {
+    var += (x - mean) * (x - mean);
+  }
+  var /= static_cast<double>(data.size());
+  EXPECT_NEAR(mean, 1.0, 0.02);
+  EXPECT_NEAR(std::sqrt(var), 2.0, 0.02);
+}
+
+TEST(gen_tests, binary_image_fill) {
+  auto image = ppc::gen::BinaryImage<int>(300, 400, 0.25, 3, 255);
+  ASSERT_EQ(image.size(), 120000U);
+  auto on = std::ranges::count(image, 255);
+  EXPECT_EQ(on + std::ranges::count(image, 0), 120000);
+  EXPECT_NEAR(static_cast<double>(on) / 120000.0, 0.25, 0.01);
+}
+
+TEST(gen_tests, csr_is_well_formed) {
+  auto csr = ppc::gen::RandomCsr<double>(300, 200, 0.1, -1.0, 1.0, 11);
+  ASSERT_EQ(csr.row_ptr.size(), 301U);
+  EXPECT_EQ(csr.row_ptr.front(), 0U);
+  EXPECT_EQ(csr.row_ptr.back(), csr.col_idx.size());
+  EXPECT_EQ(csr.values.size(), csr.col_idx.size());
+  EXPECT_NEAR(static_cast<double>(csr.col_idx.size()) / (300.0 * 200.0), 0.1, 0.01);
+  for (size_t i = 0; i < csr.rows; i++) {
+    ASSERT_LE(csr.row_ptr[i], csr.row_ptr[i + 1]);
+    for (size_t k = csr.row_ptr[i]; k < csr.row_ptr[i + 1]; k++) {
+      ASSERT_LT(csr.col_idx[k], 200U);
+      ASSERT_TRUE(k == csr.row_ptr[i] || csr.col_idx[k - 1] < csr.col_idx[k]);
+      ASSERT_NE(csr.values[k], 0.0);
+    }
+  }
+  auto again = ppc::gen::RandomCsr<double>(300, 200, 0.1, -1.0, 1.0, 11);
+  EXPECT_EQ(csr.col_idx, again.col_idx);
+  EXPECT_EQ(csr.values, again.values);
+}
+
+TEST(gen_tests, graph_has_distinct_targets_without_self_loops) {
+  auto graph = ppc::gen::RandomGraph<int>(1000, 8, 1, 10, 13);
+  ASSERT_EQ(graph.NumVertices(), 1000U);
+  ASSERT_EQ(graph.NumEdges(), 8000U);
+  for (size_t v = 0; v < graph.NumVertices(); v++) {
+    for (size_t k = graph.offsets[v]; k < graph.offsets[v + 1]; k++) {
+      ASSERT_NE(graph.targets[k], v);
+      ASSERT_LT(graph.targets[k], 1000U);
+      ASSERT_TRUE(k == graph.offsets[v] || graph.targets[k - 1] < graph.targets[k]);
+      ASSERT_GE(graph.weights[k], 1);
+      ASSERT_LE(graph.weights[k], 10);
+    }
+  }
+}
+
+TEST(gen_tests, complete_graph_when_degree_is_large) {
+  auto graph = ppc::gen::RandomGraph<double>(5, 100, 0.0, 1.0, 1);
+  ASSERT_EQ(graph.NumEdges(), 20U);
+  for (uint32_t v = 0; v < 5; v++) {
+    std::vector<uint32_t> expected;
+    for (uint32_t u = 0; u < 5; u++) {
+      if (u != v) {
+        expected.push_back(u);
+      }
+    }
+    auto first = graph.targets.begin();
+    EXPECT_EQ(std::vector<uint32_t>(first + graph.offsets[v], first + graph.offsets[v + 1]), expected);
+  }
+}
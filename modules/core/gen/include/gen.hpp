@@ -0,0 +1,235 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "core/par/include/par.hpp"
+
+// Input generators of perf and func tests. Generators are counter-based: value i is a hash of (seed, i), so every
+// element is computed independently, inputs are filled in parallel and they are identical for any count of threads.
+// Perf tests pass ppc::core::GetPerfSeed() as seed, so PPC_PERF_SEED reproduces their inputs
+namespace ppc::gen {
+
+// SplitMix64: value of counter is the SplitMix64 output at that position of sequence started from key
+struct SplitMix {
+  static constexpr uint64_t kGamma = 0x9E3779B97F4A7C15ULL;
+
+  static constexpr uint64_t Mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  static constexpr uint64_t Bits(uint64_t key, uint64_t counter) { return Mix(key + ((counter + 1) * kGamma)); }
+};
+
+// Philox4x32-10 (Salmon et al., SC'11), slower than SplitMix but passes BigCrush with any keys and counters
+struct Philox {
+  static constexpr uint64_t Bits(uint64_t key, uint64_t counter) {
+    std::array<uint32_t, 4> ctr = {static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32), 0, 0};
+    std::array<uint32_t, 2> k = {static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32)};
+    for (int round = 0; round < 10; round++) {
+      uint64_t p0 = uint64_t{0xD2511F53} * ctr[0];
+      uint64_t p1 = uint64_t{0xCD9E8D57} * ctr[2];
+      ctr = {static_cast<uint32_t>(p1 >> 32) ^ ctr[1] ^ k[0], static_cast<uint32_t>(p1),
+             static_cast<uint32_t>(p0 >> 32) ^ ctr[3] ^ k[1], static_cast<uint32_t>(p0)};
+      k[0] += 0x9E3779B9U;
+      k[1] += 0xBB67AE85U;
+    }
+    return (uint64_t{ctr[0]} << 32) | ctr[1];
+  }
+};
+
+// Random values addressed by counter. Streams of one seed are independent, so several inputs of a test are made
+// from one seed with different streams
+template <class Engine = SplitMix>
+class Random {
+ public:
+  explicit Random(uint64_t seed, uint64_t stream = 0) : key_(SplitMix::Mix(seed ^ SplitMix::Mix(stream))) {}
+
+  [[nodiscard]] uint64_t Bits(uint64_t counter) const { return Engine::Bits(key_, counter); }
+
+  // Uniform double in [0, 1) with 53 random bits
+  [[nodiscard]] double Unit(uint64_t counter) const { return static_cast<double>(Bits(counter) >> 11) * 0x1.0p-53; }
+
+  // Uniform in [lo, hi] for integers and in [lo, hi) for floating point. Integers are reduced modulo range, bias is
+  // below range / 2^64
+  template <class T>
+  [[nodiscard]] T Uniform(uint64_t counter, T lo, T hi) const {
+    if constexpr (std::is_floating_point_v<T>) {
+      return static_cast<T>(lo + ((hi - lo) * Unit(counter)));
+    } else {
+      uint64_t range = static_cast<uint64_t>(hi) - static_cast<uint64_t>(lo) + 1;
+      uint64_t bits = Bits(counter);
+      return static_cast<T>(static_cast<uint64_t>(lo) + (range == 0 ? bits : bits % range));
+    }
+  }
+
+  // Normal distribution by Box-Muller transform of two uniforms of the counter
+  [[nodiscard]] double Normal(uint64_t counter, double mean = 0.0, double stddev = 1.0) const {
+    double u1 = 1.0 - Unit(counter);
+    double u2 = static_cast<double>(Engine::Bits(~key_, counter) >> 11) * 0x1.0p-53;
+    return mean + (stddev * std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * std::numbers::pi * u2));
+  }
+
+ private:
+  uint64_t key_;
+};
+
+namespace detail {
+
+constexpr size_t kGrain = size_t{1} << 14;
+
+// Calls body(i) for every i in [0, size) on ppc::par::Stl workers
+template <class Body>
+void ForEachIndex(size_t size, size_t grain, Body &&body) {
+  ppc::par::Partition part(size, grain);
+  ppc::par::Stl::ForEachChunk(part.num_chunks, [&](size_t c) {
+    size_t end = std::min((c + 1) * part.chunk, size);
+    for (size_t i = c * part.chunk; i < end; i++) {
+      body(i);
+    }
+  });
+}
+
+}  // namespace detail
+
+template <class T, class Engine = SplitMix>
+void FillUniform(std::span<T> out, T lo, T hi, uint64_t seed, uint64_t stream = 0) {
+  Random<Engine> rng(seed, stream);
+  detail::ForEachIndex(out.size(), detail::kGrain, [&](size_t i) { out[i] = rng.Uniform(i, lo, hi); });
+}
+
+template <class T, class Engine = SplitMix>
+std::vector<T> UniformVector(size_t size, T lo, T hi, uint64_t seed, uint64_t stream = 0) {
+  std::vector<T> out(size);
+  FillUniform<T, Engine>(out, lo, hi, seed, stream);
+  return out;
+}
+
+// Dense row-major rows x cols matrix
+template <class T, class Engine = SplitMix>
+std::vector<T> UniformMatrix(size_t rows, size_t cols, T lo, T hi, uint64_t seed, uint64_t stream = 0) {
+  return UniformVector<T, Engine>(rows * cols, lo, hi, seed, stream);
+}
+
+template <class Engine = SplitMix>
+std::vector<double> NormalVector(size_t size, double mean, double stddev, uint64_t seed, uint64_t stream = 0) {
+  std::vector<double> out(size);
+  Random<Engine> rng(seed, stream);
+  detail::ForEachIndex(size, detail::kGrain, [&](size_t i) { out[i] = rng.Normal(i, mean, stddev); });
+  return out;
+}
+
+// Row-major height x width image, pixel is on with probability fill and off otherwise
+template <class T = uint8_t, class Engine = SplitMix>
+std::vector<T> BinaryImage(size_t height, size_t width, double fill, uint64_t seed, T on = T{1}, T off = T{0}) {
+  std::vector<T> image(height * width);
+  Random<Engine> rng(seed);
+  detail::ForEachIndex(image.size(), detail::kGrain, [&](size_t i) { image[i] = rng.Unit(i) < fill ? on : off; });
+  return image;
+}
+
+// Compressed sparse rows: row_ptr has rows + 1 entries, columns of every row are sorted
+template <class Value = double, class Index = uint32_t>
+struct Csr {
+  size_t rows = 0;
+  size_t cols = 0;
+  std::vector<Index> row_ptr;
+  std::vector<Index> col_idx;
+  std::vector<Value> values;
+};
+
+// Every entry is nonzero with probability density and has value uniform in [lo, hi]. Nonzeros of rows are counted
+// and written in parallel, row offsets are their parallel scan
+template <class Value = double, class Index = uint32_t, class Engine = SplitMix>
+Csr<Value, Index> RandomCsr(size_t rows, size_t cols, double density, Value lo, Value hi, uint64_t seed) {
+  Random<Engine> pattern(seed, 0);
+  Random<Engine> values(seed, 1);
+  auto is_nonzero = [&](size_t i, size_t j) { return pattern.Unit((i * cols) + j) < density; };
+
+  Csr<Value, Index> csr;
+  csr.rows = rows;
+  csr.cols = cols;
+  csr.row_ptr.assign(rows + 1, 0);
+  size_t row_grain = std::max(size_t{1}, detail::kGrain / std::max(cols, size_t{1}));
+  detail::ForEachIndex(rows, row_grain, [&](size_t i) {
+    Index count = 0;
+    for (size_t j = 0; j < cols; j++) {
+      count += is_nonzero(i, j) ? 1 : 0;
+    }
+    csr.row_ptr[i + 1] = count;
+  });
+  std::span<Index> offsets(csr.row_ptr);
+  ppc::par::ParallelScan<ppc::par::Stl, Index>(offsets, offsets, Index{0}, [](Index a, Index b) { return a + b; });
+
+  csr.col_idx.resize(csr.row_ptr[rows]);
+  csr.values.resize(csr.row_ptr[rows]);
+  detail::ForEachIndex(rows, row_grain, [&](size_t i) {
+    size_t pos = csr.row_ptr[i];
+    for (size_t j = 0; j < cols; j++) {
+      if (is_nonzero(i, j)) {
+        csr.col_idx[pos] = static_cast<Index>(j);
+        csr.values[pos] = values.Uniform((i * cols) + j, lo, hi);
+        pos++;
+      }
+    }
+  });
+  return csr;
+}
+
+// Directed graph in adjacency CSR form, edges of vertex v are targets[offsets[v]..offsets[v + 1])
+template <class Weight = int, class Index = uint32_t>
+struct Graph {
+  std::vector<Index> offsets;
+  std::vector<Index> targets;
+  std::vector<Weight> weights;
+
+  [[nodiscard]] size_t NumVertices() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+  [[nodiscard]] size_t NumEdges() const { return targets.size(); }
+};
+
+// Every vertex has min(out_degree, num_vertices - 1) edges to distinct other vertices, weights are uniform in
+// [lo, hi]. Targets are chosen by Floyd's sampling, so they are distinct without rejection loops
+template <class Weight = int, class Index = uint32_t, class Engine = SplitMix>
+Graph<Weight, Index> RandomGraph(size_t num_vertices, size_t out_degree, Weight lo, Weight hi, uint64_t seed) {
+  Random<Engine> targets(seed, 0);
+  Random<Engine> weights(seed, 1);
+  size_t degree = num_vertices == 0 ? 0 : std::min(out_degree, num_vertices - 1);
+
+  Graph<Weight, Index> graph;
+  graph.offsets.resize(num_vertices + 1);
+  for (size_t v = 0; v <= num_vertices; v++) {
+    graph.offsets[v] = static_cast<Index>(v * degree);
+  }
+  graph.targets.resize(num_vertices * degree);
+  graph.weights.resize(num_vertices * degree);
+  detail::ForEachIndex(num_vertices, std::max(size_t{1}, detail::kGrain / std::max(degree, size_t{1})), [&](size_t v) {
+    auto edges = std::span<Index>(graph.targets).subspan(v * degree, degree);
+    // Sample of [0, num_vertices - 2], values from v are shifted by one to skip self loop
+    for (size_t k = 0; k < degree; k++) {
+      size_t top = num_vertices - 1 - degree + k;
+      auto candidate = targets.template Uniform<size_t>((v * degree) + k, 0, top);
+      auto used = edges.subspan(0, k);
+      if (std::find(used.begin(), used.end(), static_cast<Index>(candidate)) != used.end()) {
+        candidate = top;
+      }
+      edges[k] = static_cast<Index>(candidate);
+    }
+    std::sort(edges.begin(), edges.end());
+    for (size_t k = 0; k < degree; k++) {
+      edges[k] = static_cast<Index>(edges[k] >= v ? edges[k] + 1 : edges[k]);
+      graph.weights[(v * degree) + k] = weights.Uniform((v * degree) + k, lo, hi);
+    }
+  });
+  return graph;
+}
+
+}  // namespace ppc::gen
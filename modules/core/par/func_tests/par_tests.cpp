@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "core/par/include/par.hpp"
+
+namespace {
+
+template <class Backend>
+class ParTest : public ::testing::Test {};
+
+using Backends = ::testing::Types<ppc::par::Seq, ppc::par::Omp, ppc::par::Stl>;
+TYPED_TEST_SUITE(ParTest, Backends);
+
+std::vector<double> Fractions(size_t size) {
+  std::vector<double> data(size);
+  for (size_t i = 0; i < size; i++) {
+    data[i] = 1.0 / static_cast<double>(i + 1) - 0.3;
+  }
+  return data;
+}
+
+}  // namespace
+
+TYPED_TEST(ParTest, reduce_sum) {
+  std::vector<int64_t> data(100003);
+  std::iota(data.begin(), data.end(), -50000);
+  auto sum = ppc::par::ParallelReduce<TypeParam>(
+      0, data.size(), int64_t{0},
+      [&](size_t begin, size_t end) { return std::accumulate(data.begin() + begin, data.begin() + end, int64_t{0}); },
+      std::plus<>());
+  EXPECT_EQ(sum, std::accumulate(data.begin(), data.end(), int64_t{0}));
+}
+
+TYPED_TEST(ParTest, reduce_is_same_for_every_backend) {
+  auto data = Fractions(1 << 20);
+  auto map = [&](size_t begin, size_t end) {
+    double acc = 0.0;
+    for (size_t i = begin; i < end; i++) {
+      acc += data[i] * data[i];
+    }
+    return acc;
+  };
+  double seq = ppc::par::ParallelReduce<ppc::par::Seq>(0, data.size(), 0.0, map, std::plus<>());
+  double par = ppc::par::ParallelReduce<TypeParam>(0, data.size(), 0.0, map, std::plus<>());
+  EXPECT_EQ(seq, par);
+}
+
+TYPED_TEST(ParTest, reduce_empty_range) {
+  auto res = ppc::par::ParallelReduce<TypeParam>(
+      5, 5, 7, [](size_t, size_t) { return 1; }, std::plus<>());
+  EXPECT_EQ(res, 7);
+}
+
+TYPED_TEST(ParTest, reduce_min_max) {
+  std::vector<uint8_t> data(70000, 100);
+  data[12345] = 3;
+  data[69999] = 250;
+  using MinMax = std::pair<uint8_t, uint8_t>;
+  auto res = ppc::par::ParallelReduce<TypeParam>(
+      0, data.size(), MinMax{255, 0},
+      [&](size_t begin, size_t end) {
+        MinMax acc{255, 0};
+        for (size_t i = begin; i < end; i++) {
+          acc = {std::min(acc.first, data[i]), std::max(acc.second, data[i])};
+        }
+        return acc;
+      },
+      [](MinMax a, MinMax b) { return MinMax{std::min(a.first, b.first), std::max(a.second, b.second)}; });
+  EXPECT_EQ(res.first, 3);
+  EXPECT_EQ(res.second, 250);
+}
+
+TYPED_TEST(ParTest, for_2d_visits_every_cell_once) {
+  const size_t rows = 131;
+  const size_t cols = 517;
+  std::vector<int> visits(rows * cols, 0);
+  ppc::par::ParallelFor2D<TypeParam>(
+      rows, cols,
+      [&](size_t row_begin, size_t row_end, size_t col_begin, size_t col_end) {
+        for (size_t i = row_begin; i < row_end; i++) {
+          for (size_t j = col_begin; j < col_end; j++) {
+            visits[(i * cols) + j]++;
+          }
+        }
+      },
+      16, 64);
+  EXPECT_EQ(std::count(visits.begin(), visits.end(), 1), static_cast<std::ptrdiff_t>(rows * cols));
+}
+
+TYPED_TEST(ParTest, scan_matches_partial_sum) {
+  std::vector<int64_t> data(1000003);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<int64_t>(i % 7) - 3;
+  }
+  std::vector<int64_t> expected(data.size());
+  std::partial_sum(data.begin(), data.end(), expected.begin());
+  std::vector<int64_t> out(data.size());
+  ppc::par::ParallelScan<TypeParam, int64_t>(data, out, 0, std::plus<>());
+  EXPECT_EQ(out, expected);
+}
+
+TYPED_TEST(ParTest, scan_in_place) {
+  std::vector<double> data = Fractions(50000);
+  std::vector<double> expected(data.size());
+  ppc::par::ParallelScan<ppc::par::Seq, double>(data, expected, 0.0, std::plus<>());
+  ppc::par::ParallelScan<TypeParam, double>(data, data, 0.0, std::plus<>());
+  EXPECT_EQ(data, expected);
+}
+
+TYPED_TEST(ParTest, scan_small_input) {
+  std::vector<int> data = {3, 1, 4, 1, 5};
+  ppc::par::ParallelScan<TypeParam, int>(data, data, 0, std::plus<>());
+  EXPECT_EQ(data, (std::vector<int>{3, 4, 8, 9, 14}));
+  std::vector<int> empty;
+  ppc::par::ParallelScan<TypeParam, int>(empty, empty, 0, std::plus<>());
+  EXPECT_TRUE(empty.empty());
+}
+
+TYPED_TEST(ParTest, histogram_counts_bins) {
+  std::vector<uint8_t> image(300007);
+  for (size_t i = 0; i < image.size(); i++) {
+    image[i] = static_cast<uint8_t>((i * 31) % 251);
+  }
+  auto hist = ppc::par::ParallelHistogram<TypeParam>(image.size(), 256, [&](size_t i) { return image[i]; });
+  std::vector<size_t> expected(256, 0);
+  for (auto pixel : image) {
+    expected[pixel]++;
+  }
+  EXPECT_EQ(hist, expected);
+}
+
+TYPED_TEST(ParTest, histogram_skips_out_of_range_bins) {
+  auto hist = ppc::par::ParallelHistogram<TypeParam>(9996, 4, [](size_t i) { return static_cast<int>(i % 6) - 1; });
+  ASSERT_EQ(hist.size(), 4U);
+  EXPECT_EQ(std::accumulate(hist.begin(), hist.end(), size_t{0}), 9996U * 4 / 6);
+  EXPECT_TRUE(ppc::par::ParallelHistogram<TypeParam>(0, 4, [](size_t) { return 0; }) == std::vector<size_t>(4, 0));
+}
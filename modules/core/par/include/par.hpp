@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "core/util/include/thread_pool.hpp"
+
+// Parallel algorithms shared by tasks. Every algorithm is templated on backend tag which only knows how to run
+// independent chunks, so partitioning and kernels are written once for all technologies.
+// Backend provides NumThreads() and ForEachChunk(num_chunks, chunk_body) which calls chunk_body(c) for every chunk.
+// ppc::par::Tbb is declared in par_tbb.hpp, because only TBB tasks link TBB
+namespace ppc::par {
+
+// Calling thread only
+struct Seq {
+  static size_t NumThreads() { return 1; }
+
+  template <class Body>
+  static void ForEachChunk(size_t num_chunks, Body &&body) {
+    for (size_t c = 0; c < num_chunks; c++) {
+      body(c);
+    }
+  }
+};
+
+// OpenMP threads, same as Seq if code is compiled without OpenMP
+struct Omp {
+  static size_t NumThreads() {
+#ifdef _OPENMP
+    return static_cast<size_t>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+  }
+
+  template <class Body>
+  static void ForEachChunk(size_t num_chunks, Body &&body) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (num_chunks > 1)
+    for (long long c = 0; c < static_cast<long long>(num_chunks); c++) {
+      body(static_cast<size_t>(c));
+    }
+#else
+    Seq::ForEachChunk(num_chunks, body);
+#endif
+  }
+};
+
+// Workers of ppc::util::ThreadPool::Global(), threads are reused between calls
+struct Stl {
+  static size_t NumThreads() { return ppc::util::ThreadPool::Global().NumThreads(); }
+
+  template <class Body>
+  static void ForEachChunk(size_t num_chunks, Body &&body) {
+    if (num_chunks <= 1) {
+      Seq::ForEachChunk(num_chunks, body);
+      return;
+    }
+    ppc::util::ThreadPool::Global().ParallelFor(0, num_chunks, body, 1);
+  }
+};
+
+// Chunks of range depend only on its size and grain, never on count of threads, so floating point reductions and
+// scans give the same bits with every backend and thread count
+constexpr size_t kDefaultGrain = size_t{1} << 12;
+constexpr size_t kMaxChunks = 256;
+
+struct Partition {
+  size_t chunk = 1;
+  size_t num_chunks = 0;
+
+  Partition(size_t size, size_t grain) {
+    if (size == 0) {
+      return;
+    }
+    chunk = std::max({grain, size_t{1}, (size + kMaxChunks - 1) / kMaxChunks});
+    num_chunks = (size + chunk - 1) / chunk;
+  }
+};
+
+// Reduces map(chunk_begin, chunk_end) over chunks of [begin, end), partial results are combined in order of chunks
+template <class Backend, class T, class Map, class Reduce>
+T ParallelReduce(size_t begin, size_t end, T identity, Map &&map, Reduce &&reduce, size_t grain = kDefaultGrain) {
+  if (end <= begin) {
+    return identity;
+  }
+  Partition part(end - begin, grain);
+  if (part.num_chunks == 1) {
+    return reduce(std::move(identity), map(begin, end));
+  }
+  std::vector<T> partial(part.num_chunks, identity);
+  Backend::ForEachChunk(part.num_chunks, [&](size_t c) {
+    size_t chunk_begin = begin + (c * part.chunk);
+    partial[c] = map(chunk_begin, std::min(chunk_begin + part.chunk, end));
+  });
+  T result = std::move(identity);
+  for (auto &value : partial) {
+    result = reduce(std::move(result), std::move(value));
+  }
+  return result;
+}
+
+// Calls body(row_begin, row_end, col_begin, col_end) for tiles of rows x cols grid, tiles keep working set of
+// stencils and blocked matrix kernels in cache
+template <class Backend, class Body>
+void ParallelFor2D(size_t rows, size_t cols, Body &&body, size_t tile_rows = 64, size_t tile_cols = 256) {
+  if (rows == 0 || cols == 0) {
+    return;
+  }
+  tile_rows = std::max(tile_rows, size_t{1});
+  tile_cols = std::max(tile_cols, size_t{1});
+  size_t row_tiles = (rows + tile_rows - 1) / tile_rows;
+  size_t col_tiles = (cols + tile_cols - 1) / tile_cols;
+  Backend::ForEachChunk(row_tiles * col_tiles, [&](size_t tile) {
+    size_t row_begin = (tile / col_tiles) * tile_rows;
+    size_t col_begin = (tile % col_tiles) * tile_cols;
+    body(row_begin, std::min(row_begin + tile_rows, rows), col_begin, std::min(col_begin + tile_cols, cols));
+  });
+}
+
+// Inclusive scan out[i] = in[0] op ... op in[i] for associative op. Chunk totals are reduced in the first pass and
+// chunks are rescanned from their offsets in the second one. out may be the same span as in
+template <class Backend, class T, class Op>
+void ParallelScan(std::span<const T> in, std::span<T> out, T identity, Op &&op, size_t grain = kDefaultGrain) {
+  size_t size = std::min(in.size(), out.size());
+  Partition part(size, grain);
+  auto scan_chunk = [&](size_t c, T acc) {
+    size_t end = std::min((c + 1) * part.chunk, size);
+    for (size_t i = c * part.chunk; i < end; i++) {
+      acc = op(std::move(acc), in[i]);
+      out[i] = acc;
+    }
+  };
+  if (part.num_chunks <= 1) {
+    if (size != 0) {
+      scan_chunk(0, std::move(identity));
+    }
+    return;
+  }
+  std::vector<T> offset(part.num_chunks, identity);
+  Backend::ForEachChunk(part.num_chunks - 1, [&](size_t c) {
+    T acc = identity;
+    size_t end = std::min((c + 1) * part.chunk, size);
+    for (size_t i = c * part.chunk; i < end; i++) {
+      acc = op(std::move(acc), in[i]);
+    }
+    offset[c + 1] = std::move(acc);
+  });
+  for (size_t c = 1; c < part.num_chunks; c++) {
+    offset[c] = op(offset[c - 1], std::move(offset[c]));
+  }
+  Backend::ForEachChunk(part.num_chunks, [&](size_t c) { scan_chunk(c, offset[c]); });
+}
+
+// Counts bin_of(i) over [0, size), bins outside [0, num_bins) are skipped. Every thread fills private histogram,
+// so there are no atomics or false sharing in the hot loop
+template <class Backend, class BinOf>
+std::vector<size_t> ParallelHistogram(size_t size, size_t num_bins, BinOf &&bin_of, size_t grain = kDefaultGrain) {
+  std::vector<size_t> hist(num_bins, 0);
+  if (size == 0 || num_bins == 0) {
+    return hist;
+  }
+  // Counts are exact in any order, so chunks are bounded by threads to keep memory of private histograms small
+  size_t num_chunks = std::min(Partition(size, grain).num_chunks, Backend::NumThreads());
+  size_t chunk = (size + num_chunks - 1) / num_chunks;
+  std::vector<std::vector<size_t>> local(num_chunks);
+  Backend::ForEachChunk(num_chunks, [&](size_t c) {
+    auto &counts = (c == 0) ? hist : local[c];
+    counts.assign(num_bins, 0);
+    size_t end = std::min((c + 1) * chunk, size);
+    for (size_t i = c * chunk; i < end; i++) {
+      auto bin = static_cast<size_t>(bin_of(i));
+      if (bin < num_bins) {
+        counts[bin]++;
+      }
+    }
+  });
+  for (size_t c = 1; c < num_chunks; c++) {
+    for (size_t bin = 0; bin < num_bins; bin++) {
+      hist[bin] += local[c][bin];
+    }
+  }
+  return hist;
+}
+
+}  // namespace ppc::par
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/task_arena.h>
+
+#include <cstddef>
+
+#include "core/par/include/par.hpp"
+
+namespace ppc::par {
+
+// Tasks of current TBB arena, chunks are balanced by work stealing
+struct Tbb {
+  static size_t NumThreads() { return static_cast<size_t>(tbb::this_task_arena::max_concurrency()); }
+
+  template <class Body>
+  static void ForEachChunk(size_t num_chunks, Body &&body) {
+    if (num_chunks <= 1) {
+      Seq::ForEachChunk(num_chunks, body);
+      return;
+    }
+    tbb::parallel_for(size_t{0}, num_chunks, [&](size_t c) { body(c); });
+  }
+};
+
+}  // namespace ppc::par
@@ -1,13 +1,30 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "core/perf/func_tests/test_task.hpp"
+#include "core/perf/include/hw_counters.hpp"
+#include "core/perf/include/machine_peak.hpp"
+#include "core/perf/include/output_digest.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/perf_report.hpp"
+#include "core/perf/include/size_sweep.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/aligned_allocator.hpp"
 
 TEST(perf_tests, check_perf_pipeline) {
   // Create data
@@ -175,3 +192,633 @@ TEST(perf_tests, check_perf_task_float) {
   ASSERT_LE(perf_results->time_sec, ppc::core::PerfResults::kMaxTime);
   EXPECT_EQ(out[0], in.size());
 }
+
+TEST(perf_tests, check_perf_samples_with_warmup) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes: every timer call advances fake clock by 1 second
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  perf_attr->num_warmup = 3;
+  uint64_t timer_calls = 0;
+  perf_attr->current_timer = [&] { return static_cast<double>(timer_calls++); };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+
+  // Warmup runs are not measured
+  EXPECT_EQ(timer_calls, 10U);
+  ASSERT_EQ(perf_results->samples.size(), 5U);
+  EXPECT_EQ(perf_results->num_running, 5U);
+  EXPECT_EQ(perf_results->num_warmup, 3U);
+  EXPECT_DOUBLE_EQ(perf_results->time_sec, 5.0);
+  EXPECT_DOUBLE_EQ(perf_results->median_sec, 1.0);
+  EXPECT_DOUBLE_EQ(perf_results->stddev_sec, 0.0);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_statistics) {
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  for (int i = 10; i >= 1; i--) {
+    perf_results->samples.push_back(static_cast<double>(i));
+  }
+
+  ppc::core::Perf::CalcStatistics(perf_results);
+
+  EXPECT_DOUBLE_EQ(perf_results->min_sec, 1.0);
+  EXPECT_DOUBLE_EQ(perf_results->max_sec, 10.0);
+  EXPECT_DOUBLE_EQ(perf_results->mean_sec, 5.5);
+  EXPECT_DOUBLE_EQ(perf_results->median_sec, 5.5);
+  EXPECT_DOUBLE_EQ(perf_results->p90_sec, 9.1);
+  EXPECT_DOUBLE_EQ(perf_results->p99_sec, 9.91);
+  EXPECT_NEAR(perf_results->stddev_sec, 3.0276503541, 1e-9);
+}
+
+TEST(perf_tests, check_perf_auto_num_running) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes: every run takes 0.5 second of fake clock
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 1;
+  perf_attr->target_time_sec = 3.0;
+  uint64_t timer_calls = 0;
+  perf_attr->current_timer = [&] { return 0.5 * static_cast<double>(timer_calls++); };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+
+  EXPECT_EQ(perf_results->num_running, 6U);
+  EXPECT_DOUBLE_EQ(perf_results->time_sec, 3.0);
+
+  // Count of runs is limited from above
+  perf_attr->target_time_sec = 1000.0;
+  perf_attr->max_num_running = 20;
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  EXPECT_EQ(perf_results->num_running, 20U);
+}
+
+TEST(perf_tests, check_perf_report_parse_test_path) {
+  std::string technology;
+  std::string task_name;
+  ppc::core::PerfReport::ParseTestPath("/home/user/ppc/tasks/omp/example/perf_tests/main.cpp", technology,
+                                       task_name);
+  EXPECT_EQ(technology, "omp");
+  EXPECT_EQ(task_name, "example");
+
+  ppc::core::PerfReport::ParseTestPath("main.cpp", technology, task_name);
+  EXPECT_EQ(technology, "unknown");
+  EXPECT_EQ(task_name, "unknown");
+}
+
+TEST(perf_tests, check_perf_report_format) {
+  ppc::core::PerfRecord record;
+  record.task_name = "example";
+  record.technology = "omp";
+  record.test_name = "suite.\"name\"";
+  record.type_of_running = "pipeline";
+  record.num_threads = 4;
+  record.results.input_size = 90000;
+  record.results.samples = {0.5, 1.5};
+  record.results.time_sec = 2.0;
+  record.hardware.cpu_model = "cpu, model";
+
+  auto json = ppc::core::PerfReport::ToJson(record);
+  EXPECT_NE(json.find(R"("task":"example")"), std::string::npos);
+  EXPECT_NE(json.find(R"("technology":"omp")"), std::string::npos);
+  EXPECT_NE(json.find(R"("test":"suite.\"name\"")"), std::string::npos);
+  EXPECT_NE(json.find(R"("num_threads":4)"), std::string::npos);
+  EXPECT_NE(json.find(R"("input_size":90000)"), std::string::npos);
+  EXPECT_NE(json.find(R"("samples":[0.5,1.5])"), std::string::npos);
+  EXPECT_EQ(json.find('\n'), std::string::npos);
+
+  auto csv = ppc::core::PerfReport::ToCsv(record);
+  EXPECT_EQ(csv.rfind("example,omp,\"suite.\"\"name\"\"\",pipeline,4,90000,", 0), 0U);
+  EXPECT_NE(csv.find("\"cpu, model\""), std::string::npos);
+}
+
+TEST(perf_tests, check_perf_report_from_env) {
+#ifndef _WIN32
+  auto report_path = std::filesystem::temp_directory_path() / "ppc_perf_report_test.csv";
+  std::filesystem::remove(report_path);
+  setenv("PPC_PERF_REPORT_FILE", report_path.string().c_str(), 1);  // NOLINT(misc-include-cleaner)
+  setenv("PPC_PERF_REPORT_FORMAT", "csv", 1);                       // NOLINT(misc-include-cleaner)
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_results->type_of_running = ppc::core::PerfResults::kTaskRun;
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  unsetenv("PPC_PERF_REPORT_FILE");    // NOLINT(misc-include-cleaner)
+  unsetenv("PPC_PERF_REPORT_FORMAT");  // NOLINT(misc-include-cleaner)
+
+  std::ifstream report(report_path);
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(report, line);) {
+    lines.push_back(line);
+  }
+  std::filesystem::remove(report_path);
+
+  ASSERT_EQ(lines.size(), 3U);
+  EXPECT_EQ(lines[0], ppc::core::PerfReport::CsvHeader());
+  EXPECT_NE(lines[1].find("perf_tests.check_perf_report_from_env,task_run,"), std::string::npos);
+#else
+  GTEST_SKIP();
+#endif
+}
+
+TEST(perf_tests, check_perf_hw_counters) {
+  // Create data
+  std::vector<uint32_t> in(200000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  perf_attr->use_hw_counters = true;
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+
+  // Counters are optional: kernel may deny access to them
+  const auto &counters = perf_results->hw_counters;
+  if (counters.available) {
+    EXPECT_GT(counters.instructions, in.size());
+    EXPECT_GT(perf_results->ipc, 0.0);
+  } else {
+    EXPECT_EQ(counters.cycles, 0U);
+    EXPECT_EQ(counters.instructions, 0U);
+    EXPECT_DOUBLE_EQ(perf_results->ipc, 0.0);
+  }
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_hw_counters_count_existing_threads) {
+  // Worker is started before counters are opened, like threads of pools which are already warm
+  std::atomic<bool> go = false;
+  uint64_t sum = 0;
+  std::thread worker([&]() {
+    while (!go.load()) {
+      std::this_thread::yield();
+    }
+    volatile uint64_t acc = 0;
+    for (uint64_t i = 0; i < 10000000; i++) {
+      acc = acc + i;
+    }
+    sum = acc;
+  });
+
+  ppc::core::HwCounterGroup counters;
+  counters.Start();
+  go = true;
+  worker.join();
+  counters.Stop();
+
+  EXPECT_EQ(sum, 10000000ULL * 9999999ULL / 2);
+  auto values = counters.Read();
+  if (values.available) {
+    EXPECT_GT(values.instructions, 10000000U);
+  }
+}
+
+TEST(perf_tests, check_perf_phase_timings) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+  perf_attr->num_warmup = 2;
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+
+  // Warmup runs aren't included into phase timings
+  const auto &phases = perf_results->phase_timings;
+  EXPECT_EQ(phases.validation.calls, 3U);
+  EXPECT_EQ(phases.pre_processing.calls, 3U);
+  EXPECT_EQ(phases.run.calls, 3U);
+  EXPECT_EQ(phases.post_processing.calls, 3U);
+
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  EXPECT_EQ(perf_results->phase_timings.run.calls, 3U);
+  EXPECT_EQ(perf_results->phase_timings.validation.calls, 0U);
+}
+
+TEST(perf_tests, check_perf_alloc_counters) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  using Task = ppc::test::perf::AllocatingTestTask<uint32_t>;
+  auto test_task = std::make_shared<Task>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  perf_attr->count_allocations = true;
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+
+  // Counting is disabled in sanitizer builds
+  const auto &allocs = perf_results->alloc_counters;
+  if (!ppc::core::AllocCounterGroup::IsAvailable()) {
+    EXPECT_FALSE(allocs.available);
+    GTEST_SKIP();
+  }
+  constexpr size_t kBufferBytes = Task::kBufferSize * sizeof(uint32_t);
+  EXPECT_TRUE(allocs.available);
+  EXPECT_GE(perf_results->allocations_per_run, static_cast<double>(Task::kNumBuffers + 1));
+  EXPECT_GE(perf_results->bytes_allocated_per_run, static_cast<double>(Task::kNumBuffers * kBufferBytes));
+  EXPECT_GE(allocs.peak_heap_bytes, Task::kNumBuffers * kBufferBytes);
+  EXPECT_GT(allocs.peak_rss_bytes, 0U);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_configurable_time_limit) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes with budget which any run exceeds
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+  perf_attr->max_time_sec = 1e-12;
+  perf_attr->record_time_limit = true;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  EXPECT_DOUBLE_EQ(perf_results->max_time_sec, 1e-12);
+  EXPECT_NO_THROW(ppc::core::Perf::PrintPerfStatistic(perf_results));
+  EXPECT_TRUE(perf_results->time_limit_exceeded);
+
+  perf_attr->record_time_limit = false;
+  perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  EXPECT_ANY_THROW(ppc::core::Perf::PrintPerfStatistic(perf_results));
+
+#ifndef _WIN32
+  // Budget from environment is used if attribute isn't set
+  perf_attr->max_time_sec = 0.0;
+  setenv("PPC_PERF_MAX_TIME", "100", 1);  // NOLINT(misc-include-cleaner)
+  perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  unsetenv("PPC_PERF_MAX_TIME");  // NOLINT(misc-include-cleaner)
+  EXPECT_DOUBLE_EQ(perf_results->max_time_sec, 100.0);
+  EXPECT_NO_THROW(ppc::core::Perf::PrintPerfStatistic(perf_results));
+  EXPECT_FALSE(perf_results->time_limit_exceeded);
+#endif
+}
+
+TEST(perf_tests, check_perf_sizes) {
+  EXPECT_EQ(ppc::core::GetPerfSizes(500), std::vector<uint64_t>{500});
+#ifndef _WIN32
+  setenv("PPC_PERF_SIZES", "1000,4000,16000", 1);  // NOLINT(misc-include-cleaner)
+  EXPECT_EQ(ppc::core::GetPerfSizes(500), (std::vector<uint64_t>{1000, 4000, 16000}));
+  setenv("PPC_PERF_SIZES", "1000,,x", 1);  // NOLINT(misc-include-cleaner)
+  EXPECT_THROW(ppc::core::GetPerfSizes(500), std::invalid_argument);
+  unsetenv("PPC_PERF_SIZES");  // NOLINT(misc-include-cleaner)
+#endif
+}
+
+TEST(perf_tests, check_perf_seed) {
+#ifndef _WIN32
+  setenv("PPC_PERF_SEED", "42", 1);  // NOLINT(misc-include-cleaner)
+  EXPECT_EQ(ppc::core::GetPerfSeed(), 42U);
+  setenv("PPC_PERF_SEED", "1,2", 1);  // NOLINT(misc-include-cleaner)
+  EXPECT_THROW(ppc::core::GetPerfSeed(), std::invalid_argument);
+  unsetenv("PPC_PERF_SEED");  // NOLINT(misc-include-cleaner)
+#endif
+}
+
+TEST(perf_tests, check_output_digest_values) {
+  std::vector<int> ints{1, 2, 3};
+  EXPECT_EQ(ppc::core::DigestValues(ints), ppc::core::DigestBytes(ints.data(), ints.size() * sizeof(int)));
+  EXPECT_NE(ppc::core::DigestValues(ints), ppc::core::DigestValues(std::vector<int>{1, 2, 4}));
+  EXPECT_NE(ppc::core::DigestValues(ints, ppc::core::DigestValues(ints)), ppc::core::DigestValues(ints));
+  EXPECT_EQ(ppc::core::DigestToString(0x2a), "000000000000002a");
+}
+
+TEST(perf_tests, check_perf_output_digest) {
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+  ppc::core::Perf perf_analyzer(test_task);
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  EXPECT_TRUE(perf_results->output_digest.empty());
+
+  perf_attr->output_digest = [&] { return ppc::core::DigestValues(out); };
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  auto expected = ppc::core::DigestValues(std::vector<uint32_t>{2000});
+  EXPECT_EQ(perf_results->output_digest, ppc::core::DigestToString(expected));
+}
+
+namespace {
+
+ppc::core::SweepInput GenerateOnes(uint64_t size) {
+  auto in = std::make_shared<std::vector<uint32_t>>(size, 1);
+  auto out = std::make_shared<std::vector<uint32_t>>(1, 0);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in->data()));
+  task_data->inputs_count.emplace_back(in->size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out->data()));
+  task_data->outputs_count.emplace_back(out->size());
+  return {.task_data = task_data,
+          .storage = std::make_shared<std::pair<decltype(in), decltype(out)>>(in, out),
+          .flops = static_cast<double>(size),
+          .bytes = static_cast<double>(size * sizeof(uint32_t))};
+}
+
+}  // namespace
+
+TEST(perf_tests, check_size_sweep_fit_exponent) {
+  std::vector<double> x{10, 20, 40, 80};
+  std::vector<double> y{3, 12, 48, 192};
+  EXPECT_NEAR(ppc::core::SizeSweep::FitExponent(x, y), 2.0, 1e-9);
+  EXPECT_DOUBLE_EQ(ppc::core::SizeSweep::FitExponent({10}, {3}), 0.0);
+}
+
+TEST(perf_tests, check_size_sweep_sizes) {
+  ppc::core::SweepAttr attr{.min_size = 100, .max_size = 1000, .growth = 3.0};
+  ppc::core::SizeSweep sweep(nullptr, nullptr, attr);
+  EXPECT_EQ(sweep.Sizes(), (std::vector<uint64_t>{100, 300, 900}));
+  EXPECT_THROW(ppc::core::SizeSweep(nullptr, nullptr, {.growth = 1.0}), std::invalid_argument);
+#ifndef _WIN32
+  setenv("PPC_PERF_SIZES", "50,70", 1);  // NOLINT(misc-include-cleaner)
+  EXPECT_EQ(sweep.Sizes(), ppc::core::GetPerfSizes(100));
+  unsetenv("PPC_PERF_SIZES");  // NOLINT(misc-include-cleaner)
+#endif
+}
+
+TEST(perf_tests, check_size_sweep_linear_task) {
+  ppc::core::SweepAttr attr{.min_size = 1 << 18, .max_size = 1 << 22, .num_running = 5};
+  ppc::core::SizeSweep sweep(
+      [](ppc::core::TaskDataPtr data) { return std::make_shared<ppc::test::perf::TestTask<uint32_t>>(data); },
+      GenerateOnes, attr);
+  auto results = sweep.Run();
+  ppc::core::SizeSweep::Print("perf_tests", results);
+
+  ASSERT_EQ(results.points.size(), 5U);
+  EXPECT_EQ(results.points.back().input_size, uint64_t{1} << 22);
+  EXPECT_GT(results.points.back().elements_per_sec, 0.0);
+  EXPECT_GT(results.points.back().gbytes_per_sec, 0.0);
+  // Fit of measured times depends on load of machine, it is checked on exact data in check_size_sweep_fit_exponent
+  EXPECT_GT(results.input_exponent, 0.0);
+}
+
+TEST(perf_tests, check_size_sweep_quadratic_task) {
+  ppc::core::SweepAttr attr{.min_size = 1000, .max_size = 8000, .num_running = 3};
+  ppc::core::SizeSweep sweep(
+      [](ppc::core::TaskDataPtr data) { return std::make_shared<ppc::test::perf::QuadraticTestTask<uint32_t>>(data); },
+      GenerateOnes, attr);
+  auto results = sweep.Run();
+
+  ASSERT_EQ(results.points.size(), 4U);
+  EXPECT_GT(results.input_exponent, 0.0);
+  EXPECT_DOUBLE_EQ(results.size_exponent, results.input_exponent);
+}
+
+TEST(perf_tests, check_perf_throughput) {
+  std::vector<uint32_t> in(1 << 20, 1);
+  std::vector<uint32_t> out(1, 0);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto test_task = std::make_shared<ppc::test::perf::WorkTestTask<uint32_t>>(task_data);
+  ppc::core::Perf perf_analyzer(test_task);
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  perf_analyzer.PrintPerfStatistic(perf_results);
+
+  EXPECT_DOUBLE_EQ(perf_results->work.flops, static_cast<double>(in.size()));
+  EXPECT_GT(perf_results->gflops, 0.0);
+  EXPECT_NEAR(perf_results->arithmetic_intensity, 1.0 / sizeof(uint32_t), 1e-12);
+  // Peak is measured only on request
+  EXPECT_DOUBLE_EQ(perf_results->peak_gflops, 0.0);
+}
+
+TEST(perf_tests, check_perf_throughput_without_work) {
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+  ppc::core::Perf perf_analyzer(test_task);
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  perf_attr->measure_machine_peak = true;
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+
+  EXPECT_DOUBLE_EQ(perf_results->gflops, 0.0);
+  EXPECT_DOUBLE_EQ(perf_results->roofline_efficiency, 0.0);
+}
+
+TEST(perf_tests, check_machine_peak) {
+  auto peak = ppc::core::MeasureMachinePeak(size_t{8} << 20);
+  EXPECT_GT(peak.gflops, 0.0);
+  EXPECT_GT(peak.gbytes_per_sec, 0.0);
+  EXPECT_GE(peak.num_threads, 1U);
+}
+
+TEST(perf_tests, check_perf_roofline) {
+  std::vector<uint32_t> in(1 << 20, 1);
+  std::vector<uint32_t> out(1, 0);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto test_task = std::make_shared<ppc::test::perf::WorkTestTask<uint32_t>>(task_data);
+  ppc::core::Perf perf_analyzer(test_task);
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  perf_attr->measure_machine_peak = true;
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  perf_analyzer.PrintPerfStatistic(perf_results);
+
+  EXPECT_GT(perf_results->peak_gflops, 0.0);
+  EXPECT_GT(perf_results->peak_gbytes_per_sec, 0.0);
+  EXPECT_GT(perf_results->roofline_efficiency, 0.0);
+  EXPECT_GT(perf_results->bandwidth_efficiency, 0.0);
+}
+
+namespace {
+
+// Median of pipeline runs, so allocation and first touch of task's buffers are measured with the kernel
+template <class KernelTask, class Container>
+double MedianPipelineTime(const ppc::core::TaskDataPtr &task_data, const Container &storage) {
+  auto test_task = std::make_shared<KernelTask>(task_data, storage);
+  ppc::core::Perf perf_analyzer(test_task);
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - t0).count();
+  };
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  return perf_results->median_sec;
+}
+
+// Same kernel with data in std::vector and in ppc::util::Buffer backed by huge pages
+template <template <class> class KernelTask>
+void CompareBufferWithVector(const char *kernel, std::vector<std::vector<double>> &inputs) {
+  std::vector<double> out_vector(inputs[0].size());
+  std::vector<double> out_buffer(inputs[0].size());
+  auto make_data = [&](std::vector<double> &out) {
+    auto task_data = std::make_shared<ppc::core::TaskData>();
+    for (auto &input : inputs) {
+      task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+      task_data->inputs_count.emplace_back(input.size());
+    }
+    task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    task_data->outputs_count.emplace_back(out.size());
+    return task_data;
+  };
+  double vector_sec = MedianPipelineTime<KernelTask<std::vector<double>>>(make_data(out_vector), std::vector<double>());
+  ppc::util::MemoryOptions huge_pages{.huge_pages = true};
+  double buffer_sec = MedianPipelineTime<KernelTask<ppc::util::Buffer<double>>>(
+      make_data(out_buffer), ppc::util::Buffer<double>(ppc::util::AlignedAllocator<double>(huge_pages)));
+  std::cout << "perf_tests:" << kernel << ":buffer_vs_vector" << std::scientific << std::setprecision(4)
+            << " vector=" << vector_sec << " buffer=" << buffer_sec << std::fixed
+            << " speedup=" << vector_sec / buffer_sec << '\n';
+
+  // Timings are only reported, they depend on machine and its THP settings
+  EXPECT_GT(vector_sec, 0.0);
+  EXPECT_GT(buffer_sec, 0.0);
+  EXPECT_EQ(out_vector, out_buffer);
+}
+
+}  // namespace
+
+TEST(perf_tests, check_buffer_vs_vector_matmul) {
+  const size_t n = 384;
+  std::vector<std::vector<double>> inputs(2, std::vector<double>(n * n));
+  for (size_t i = 0; i < n * n; i++) {
+    inputs[0][i] = static_cast<double>(i % 17) - 8.0;
+    inputs[1][i] = static_cast<double>(i % 13) * 0.5;
+  }
+  CompareBufferWithVector<ppc::test::perf::MatMulTestTask>("matmul", inputs);
+}
+
+TEST(perf_tests, check_buffer_vs_vector_stencil) {
+  const size_t width = 2048;
+  std::vector<std::vector<double>> inputs(1, std::vector<double>(width * width));
+  for (size_t i = 0; i < inputs[0].size(); i++) {
+    inputs[0][i] = static_cast<double>((i * 31) % 256);
+  }
+  CompareBufferWithVector<ppc::test::perf::StencilTestTask>("stencil", inputs);
+}
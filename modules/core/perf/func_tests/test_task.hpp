@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -48,4 +50,149 @@ class FakePerfTask : public TestTask<T> {
   }
 };
 
+// Run() takes time quadratic in count of input elements
+template <class T>
+class QuadraticTestTask : public TestTask<T> {
+ public:
+  explicit QuadraticTestTask(ppc::core::TaskDataPtr task_data) : TestTask<T>(task_data) {}
+
+  bool RunImpl() override {
+    const auto *input = reinterpret_cast<const T *>(this->task_data->inputs[0]);
+    auto *output = reinterpret_cast<T *>(this->task_data->outputs[0]);
+    size_t count = this->task_data->inputs_count[0];
+    output[0] = 0;
+    for (size_t i = 0; i < count; i++) {
+      for (size_t j = i; j < count; j++) {
+        output[0] += input[i] * input[j];
+      }
+    }
+    return true;
+  }
+};
+
+// Declares one addition and one read element per input element
+template <class T>
+class WorkTestTask : public TestTask<T> {
+ public:
+  explicit WorkTestTask(ppc::core::TaskDataPtr task_data) : TestTask<T>(task_data) {}
+
+  [[nodiscard]] ppc::core::WorkEstimate EstimateWork() const override {
+    auto count = static_cast<double>(this->task_data->inputs_count[0]);
+    return {.flops = count, .bytes = count * sizeof(T)};
+  }
+};
+
+// Allocates and frees fixed number of buffers on every run
+template <class T>
+class AllocatingTestTask : public TestTask<T> {
+ public:
+  static constexpr size_t kNumBuffers = 4;
+  static constexpr size_t kBufferSize = 1 << 16;
+
+  explicit AllocatingTestTask(ppc::core::TaskDataPtr task_data) : TestTask<T>(task_data) {}
+
+  bool RunImpl() override {
+    std::vector<std::unique_ptr<T[]>> buffers;
+    buffers.reserve(kNumBuffers);
+    for (size_t i = 0; i < kNumBuffers; i++) {
+      buffers.push_back(std::make_unique<T[]>(kBufferSize));
+    }
+    return TestTask<T>::RunImpl();
+  }
+};
+
+// Side of square matrix with count elements
+inline size_t SquareSide(size_t count) {
+  size_t side = 0;
+  while ((side + 1) * (side + 1) <= count) {
+    side++;
+  }
+  return side;
+}
+
+// Dense n x n product C = A * B, inputs are copied into Container, so allocator of Container is measured too.
+// Empty storage passes allocator (e.g. ppc::util::Buffer with huge pages) to all matrices
+template <class Container>
+class MatMulTestTask : public ppc::core::Task {
+ public:
+  explicit MatMulTestTask(const ppc::core::TaskDataPtr &task_data, const Container &storage = Container())
+      : Task(task_data), a_(storage), b_(storage), c_(storage) {}
+
+  bool ValidationImpl() override {
+    return task_data->inputs_count[0] == task_data->inputs_count[1] &&
+           task_data->inputs_count[0] == task_data->outputs_count[0];
+  }
+
+  bool PreProcessingImpl() override {
+    auto a = task_data->Input<const double>(0);
+    auto b = task_data->Input<const double>(1);
+    a_.assign(a.begin(), a.end());
+    b_.assign(b.begin(), b.end());
+    c_.assign(a.size(), 0.0);
+    n_ = SquareSide(a.size());
+    return true;
+  }
+
+  bool RunImpl() override {
+    for (size_t i = 0; i < n_; i++) {
+      for (size_t k = 0; k < n_; k++) {
+        double a_ik = a_[(i * n_) + k];
+        for (size_t j = 0; j < n_; j++) {
+          c_[(i * n_) + j] += a_ik * b_[(k * n_) + j];
+        }
+      }
+    }
+    return true;
+  }
+
+  bool PostProcessingImpl() override {
+    std::ranges::copy(c_, task_data->Output<double>(0).begin());
+    return true;
+  }
+
+ private:
+  Container a_, b_, c_;
+  size_t n_ = 0;
+};
+
+// Horizontal 3x1 Gaussian filter of square image
+template <class Container>
+class StencilTestTask : public ppc::core::Task {
+ public:
+  explicit StencilTestTask(const ppc::core::TaskDataPtr &task_data, const Container &storage = Container())
+      : Task(task_data), image_(storage), filtered_(storage) {}
+
+  bool ValidationImpl() override {
+    return task_data->inputs_count[0] > 0 && task_data->inputs_count[0] == task_data->outputs_count[0];
+  }
+
+  bool PreProcessingImpl() override {
+    auto image = task_data->Input<const double>(0);
+    image_.assign(image.begin(), image.end());
+    filtered_.assign(image.size(), 0.0);
+    width_ = SquareSide(image.size());
+    return true;
+  }
+
+  bool RunImpl() override {
+    for (size_t row = 0; row < image_.size(); row += width_) {
+      filtered_[row] = image_[row];
+      filtered_[row + width_ - 1] = image_[row + width_ - 1];
+      for (size_t j = row + 1; j + 1 < row + width_; j++) {
+        filtered_[j] = (0.25 * image_[j - 1]) + (0.5 * image_[j]) + (0.25 * image_[j + 1]);
+      }
+    }
+    return true;
+  }
+
+  bool PostProcessingImpl() override {
+    std::ranges::copy(filtered_, task_data->Output<double>(0).begin());
+    return true;
+  }
+
+ private:
+  Container image_, filtered_;
+  size_t width_ = 1;
+};
+
 }  // namespace ppc::test::perf
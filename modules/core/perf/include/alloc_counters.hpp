@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+namespace ppc::core {
+
+// Heap usage of measured runs
+struct AllocCounters {
+  // totals over measured runs, calls of global operator new (including allocations of std containers)
+  uint64_t num_allocations = 0;
+  uint64_t bytes_allocated = 0;
+  // maximum over runs of heap bytes live above the level at start of the run
+  uint64_t peak_heap_bytes = 0;
+  // maximum resident set size during measured runs (process-wide high-water mark if it can't be reset)
+  uint64_t peak_rss_bytes = 0;
+  // false if operator new isn't interposed (sanitizer builds or PPC_DISABLE_ALLOC_COUNTERS)
+  bool available = false;
+};
+
+// Counts allocations of all threads through replaced global operator new/delete between Start/Stop pairs.
+// Outside of Start/Stop the replaced operators only forward to malloc/free
+class AllocCounterGroup {
+ public:
+  AllocCounterGroup() = default;
+  AllocCounterGroup(const AllocCounterGroup &) = delete;
+  AllocCounterGroup &operator=(const AllocCounterGroup &) = delete;
+  ~AllocCounterGroup();
+
+  [[nodiscard]] static bool IsAvailable();
+  void Start();
+  void Stop();
+  [[nodiscard]] AllocCounters Read() const;
+
+ private:
+  AllocCounters counters_;
+  uint64_t start_allocations_ = 0;
+  uint64_t start_bytes_ = 0;
+  int64_t start_live_bytes_ = 0;
+  bool running_ = false;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace ppc::core {
+
+// Values of hardware performance counters, counter is zero if it can't be opened
+struct HwCounters {
+  uint64_t cycles = 0;
+  uint64_t instructions = 0;
+  uint64_t llc_misses = 0;
+  uint64_t branch_misses = 0;
+  // false if kernel denies access to counters (e.g. perf_event_paranoid) or OS isn't Linux
+  bool available = false;
+};
+
+// Linux perf_event counters of the process: counters are opened for every thread which exists at construction and
+// are inherited by threads created later, so workers of OpenMP, TBB and ThreadPool are counted wherever they started
+class HwCounterGroup {
+ public:
+  HwCounterGroup();
+  HwCounterGroup(const HwCounterGroup &) = delete;
+  HwCounterGroup &operator=(const HwCounterGroup &) = delete;
+  ~HwCounterGroup();
+
+  [[nodiscard]] bool IsAvailable() const;
+  // Resume and pause counting, counters are accumulated between Start/Stop pairs
+  void Start();
+  void Stop();
+  [[nodiscard]] HwCounters Read() const;
+
+ private:
+  enum Counter : uint8_t { kCycles, kInstructions, kLlcMisses, kBranchMisses, kCount };
+  // Counters of one thread, -1 if counter can't be opened
+  using Fds = std::array<int, kCount>;
+  std::vector<Fds> threads_;
+};
+
+}  // namespace ppc::core
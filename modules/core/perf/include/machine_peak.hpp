@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ppc::core {
+
+// Achievable peak of current machine with PPC_NUM_THREADS threads
+struct MachinePeak {
+  // chains of independent multiply-adds
+  double gflops = 0.0;
+  // STREAM triad a[i] = b[i] + s * c[i] over arrays larger than caches
+  double gbytes_per_sec = 0.0;
+  size_t num_threads = 1;
+};
+
+// Micro-benchmarks are compiled with the same flags as tasks, so peak is reachable by task code (e.g. without
+// -march=native it is SSE2 peak, not AVX-512 one). Threads of ThreadPool::Global are used
+MachinePeak MeasureMachinePeak(size_t stream_bytes = size_t{96} << 20);
+
+// Measured on first call, takes about a second
+const MachinePeak &GetMachinePeak();
+
+}  // namespace ppc::core
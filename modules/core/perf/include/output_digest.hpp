@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::core {
+
+constexpr uint64_t kDigestSeed = 14695981039346656037ULL;
+
+// FNV-1a hash of bytes, digest of several buffers is built by passing previous digest as seed
+uint64_t DigestBytes(const void *data, size_t size, uint64_t seed = kDigestSeed);
+// 16 hex digits
+std::string DigestToString(uint64_t digest);
+
+// Digest of task output which is equal for all technologies of the same algorithm. Only exact values (integers,
+// bytes of image, ...) are hashed: floating point results of variants which sum in different order differ in last
+// bits, such outputs have to be compared with tolerance instead
+template <class T>
+uint64_t DigestValues(const std::vector<T> &values, uint64_t seed = kDigestSeed) {
+  static_assert(std::has_unique_object_representations_v<T>, "Digest is defined only for exact values");
+  return DigestBytes(values.data(), values.size() * sizeof(T), seed);
+}
+
+}  // namespace ppc::core
@@ -3,7 +3,11 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
+#include "core/perf/include/alloc_counters.hpp"
+#include "core/perf/include/hw_counters.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc::core {
@@ -11,16 +15,87 @@ namespace ppc::core {
 struct PerfAttr {
   // count of task's running
   uint64_t num_running;
+  // count of warmup runs, which are executed before measurement and not recorded
+  uint64_t num_warmup = 0;
+  // if positive, count of task's running is chosen automatically to fit this time budget (in seconds)
+  double target_time_sec = 0.0;
+  // upper bound for the automatically chosen count of task's running
+  uint64_t max_num_running = 1000;
+  // collect hardware performance counters around measured runs (also enabled by PPC_PERF_HW_COUNTERS=1)
+  bool use_hw_counters = false;
+  // count heap allocations and peak memory of measured runs (also enabled by PPC_PERF_ALLOC_COUNTERS=1)
+  bool count_allocations = false;
+  // time budget of measured runs (in seconds), if zero it is taken from PPC_PERF_MAX_TIME or PerfResults::kMaxTime
+  double max_time_sec = 0.0;
+  // exceeded budget is recorded in PerfResults instead of failing the test (also PPC_TIME_LIMIT_MODE=record)
+  bool record_time_limit = false;
+  // compare throughput of Run() with measured peak of machine (also enabled by PPC_PERF_MACHINE_PEAK=1)
+  bool measure_machine_peak = false;
+  // digest of task's output after the last run (see output_digest.hpp), variants of the same algorithm in
+  // different technologies must produce equal digests for equal inputs
+  std::function<uint64_t()> output_digest;
   std::function<double()> current_timer = [&] { return 0.0; };
 };
 
 struct PerfResults {
   // measurement of task's time (in seconds)
   double time_sec = 0.0;
+  // time of every measured run (in seconds)
+  std::vector<double> samples;
+  // sum of task's inputs_count
+  uint64_t input_size = 0;
+  // count of measured and warmup runs
+  uint64_t num_running = 0;
+  uint64_t num_warmup = 0;
+  // statistics over samples (in seconds)
+  double min_sec = 0.0;
+  double max_sec = 0.0;
+  double mean_sec = 0.0;
+  double median_sec = 0.0;
+  double p90_sec = 0.0;
+  double p99_sec = 0.0;
+  double stddev_sec = 0.0;
+  // durations of task's phases over measured runs
+  PhaseTimings phase_timings;
+  // hardware counters summed over measured runs and derived metrics
+  HwCounters hw_counters;
+  double ipc = 0.0;
+  double llc_misses_per_element = 0.0;
+  double branch_misses_per_element = 0.0;
+  // heap usage over measured runs and its averages per run
+  AllocCounters alloc_counters;
+  double allocations_per_run = 0.0;
+  double bytes_allocated_per_run = 0.0;
+  // throughput of Run() from Task::EstimateWork, zero if task doesn't declare its work
+  WorkEstimate work;
+  double gflops = 0.0;
+  double gbytes_per_sec = 0.0;
+  double arithmetic_intensity = 0.0;
+  // machine peak (if measured) and fractions of it: of roofline bound min(peak_gflops, intensity * peak bandwidth)
+  // and of peak bandwidth
+  double peak_gflops = 0.0;
+  double peak_gbytes_per_sec = 0.0;
+  double roofline_efficiency = 0.0;
+  double bandwidth_efficiency = 0.0;
+  // hex digest of output from PerfAttr::output_digest, empty if it isn't set
+  std::string output_digest;
   enum TypeOfRunning : uint8_t { kPipeline, kTaskRun, kNone } type_of_running = kNone;
   constexpr static double kMaxTime = 10.0;
+  // budget which was applied to measurement
+  double max_time_sec = kMaxTime;
+  bool record_time_limit = false;
+  bool time_limit_exceeded = false;
 };
 
+// Input sizes at which perf test measures task: PPC_PERF_SIZES (e.g. "1000,4000,16000") or default_sizes.
+// Meaning of size (count of elements, matrix dimension, ...) is defined by input generator of the test, SizeSweep
+// takes its ladder from here too
+std::vector<uint64_t> GetPerfSizes(std::vector<uint64_t> default_sizes);
+std::vector<uint64_t> GetPerfSizes(uint64_t default_size);
+// Seed for random inputs of perf test: PPC_PERF_SEED or random one if it is not set. Equal seed gives equal inputs
+// to variants of the same algorithm in different technologies
+uint64_t GetPerfSeed();
+
 class Perf {
  public:
   // Init performance analysis with initialized task and initialized data
@@ -35,11 +110,17 @@ class Perf {
   void TaskRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::shared_ptr<PerfResults>& perf_results) const;
   // Pint results for automation checkers
   static void PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results);
+  // Calculate min/max/mean/median/percentiles/stddev over collected samples
+  static void CalcStatistics(const std::shared_ptr<PerfResults>& perf_results);
 
  private:
   std::shared_ptr<Task> task_;
-  static void CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
-                        const std::shared_ptr<PerfResults>& perf_results);
+  [[nodiscard]] uint64_t GetInputSize() const;
+  void CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
+                 const std::shared_ptr<PerfResults>& perf_results) const;
+  // GFLOP/s and GB/s of Run() from declared work, compared with machine peak if it is requested
+  void CalcThroughput(const std::shared_ptr<PerfAttr>& perf_attr,
+                      const std::shared_ptr<PerfResults>& perf_results) const;
 };
 
 }  // namespace ppc::core
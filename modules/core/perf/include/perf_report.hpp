@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "core/perf/include/perf.hpp"
+
+namespace ppc::core {
+
+struct HardwareInfo {
+  std::string cpu_model;
+  std::string hostname;
+  std::string compiler;
+  unsigned hardware_threads = 0;
+};
+
+// One line of machine-readable performance report
+struct PerfRecord {
+  std::string task_name;
+  // seq, omp, tbb, stl, mpi, all (or unknown if test isn't located in tasks directory)
+  std::string technology;
+  std::string test_name;
+  std::string type_of_running;
+  int num_threads = 1;
+  PerfResults results;
+  HardwareInfo hardware;
+};
+
+class PerfReport {
+ public:
+  enum Format : uint8_t { kJson, kCsv };
+
+  // Build record for currently running gtest test
+  static PerfRecord MakeRecord(const PerfResults& perf_results);
+  // Split path of test file like ".../tasks/omp/example/perf_tests/main.cpp" into technology and task name
+  static void ParseTestPath(const std::string& path, std::string& technology, std::string& task_name);
+
+  static std::string ToJson(const PerfRecord& record);
+  static std::string CsvHeader();
+  static std::string ToCsv(const PerfRecord& record);
+
+  // Append record to file, CSV header is written into empty file
+  static void Append(const std::string& path, Format format, const PerfRecord& record);
+  // Append record to file from PPC_PERF_REPORT_FILE (json lines or csv by PPC_PERF_REPORT_FORMAT) if it is set
+  static void AppendFromEnv(const PerfRecord& record);
+
+  // Information about current machine, collected once
+  static const HardwareInfo& GetHardwareInfo();
+};
+
+}  // namespace ppc::core
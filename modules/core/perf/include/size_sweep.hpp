@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/batch/include/batch_runner.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// Input of task for one size of sweep
+struct SweepInput {
+  TaskDataPtr task_data;
+  // owner of buffers which task_data points to
+  std::shared_ptr<void> storage;
+  // optional work of one Run() for throughput in GFLOP/s and GB/s, Task::EstimateWork is used if they are zero
+  double flops = 0.0;
+  double bytes = 0.0;
+};
+
+// Generates input of given size, meaning of size (count of elements, matrix dimension, ...) is defined by task
+using InputGenerator = std::function<SweepInput(uint64_t size)>;
+
+struct SweepAttr {
+  // sizes min_size, min_size * growth, ... up to max_size (PPC_PERF_SIZES replaces it, see GetPerfSizes)
+  uint64_t min_size = 1;
+  uint64_t max_size = 1;
+  double growth = 2.0;
+  // measured runs of Run() per size, time of size is median of them
+  uint64_t num_running = 3;
+  uint64_t num_warmup = 1;
+  // sweep stops after first size which median run time exceeds budget (in seconds), zero means no budget
+  double max_time_sec = 0.0;
+};
+
+struct SweepPoint {
+  uint64_t size = 0;
+  // sum of inputs_count
+  uint64_t input_size = 0;
+  double time_sec = 0.0;
+  double elements_per_sec = 0.0;
+  double gflops = 0.0;
+  double gbytes_per_sec = 0.0;
+};
+
+struct SweepResults {
+  std::vector<SweepPoint> points;
+  // fitted exponents k of time ~ size^k and time ~ input_size^k (1 for kernel linear in its input)
+  double size_exponent = 0.0;
+  double input_exponent = 0.0;
+};
+
+// Measures task over geometrically growing inputs and fits complexity of Run()
+class SizeSweep {
+ public:
+  SizeSweep(TaskFactory factory, InputGenerator generator, SweepAttr attr);
+  [[nodiscard]] SweepResults Run() const;
+  [[nodiscard]] std::vector<uint64_t> Sizes() const;
+
+  // Least squares slope of log(y) over log(x), points with non-positive values are skipped
+  static double FitExponent(const std::vector<double> &x, const std::vector<double> &y);
+  // One line per size and fitted exponents
+  static void Print(const std::string &name, const SweepResults &results);
+
+ private:
+  TaskFactory factory_;
+  InputGenerator generator_;
+  SweepAttr attr_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,201 @@
+#include "core/perf/include/alloc_counters.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+// Sanitizers replace operator new themselves, interposing it there would hide their reports
+#if defined(PPC_DISABLE_ALLOC_COUNTERS) || defined(_MSC_VER) || defined(__SANITIZE_ADDRESS__) || \
+    defined(__SANITIZE_THREAD__)
+#define PPC_ALLOC_COUNTERS 0
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) || __has_feature(memory_sanitizer)
+#define PPC_ALLOC_COUNTERS 0
+#endif
+#endif
+#ifndef PPC_ALLOC_COUNTERS
+#define PPC_ALLOC_COUNTERS 1
+#endif
+
+namespace {
+
+std::atomic<int> active_groups{0};
+std::atomic<uint64_t> total_allocations{0};
+std::atomic<uint64_t> total_bytes{0};
+std::atomic<int64_t> live_bytes{0};
+std::atomic<int64_t> peak_live_bytes{0};
+
+#if PPC_ALLOC_COUNTERS
+// Live bytes are tracked by usable size of block, which is known for both allocation and deallocation
+int64_t BlockSize(void *ptr) {
+#ifdef __GLIBC__
+  return static_cast<int64_t>(malloc_usable_size(ptr));
+#else
+  static_cast<void>(ptr);
+  return 0;
+#endif
+}
+
+void CountAllocation(void *ptr, std::size_t size) {
+  if (active_groups.load(std::memory_order_relaxed) == 0) {
+    return;
+  }
+  total_allocations.fetch_add(1, std::memory_order_relaxed);
+  total_bytes.fetch_add(size, std::memory_order_relaxed);
+  int64_t block_size = BlockSize(ptr);
+  int64_t live = live_bytes.fetch_add(block_size, std::memory_order_relaxed) + block_size;
+  int64_t peak = peak_live_bytes.load(std::memory_order_relaxed);
+  while (live > peak && !peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+void CountDeallocation(void *ptr) {
+  if (ptr != nullptr && active_groups.load(std::memory_order_relaxed) != 0) {
+    live_bytes.fetch_sub(BlockSize(ptr), std::memory_order_relaxed);
+  }
+}
+
+void *Allocate(std::size_t size, std::size_t alignment) {
+  size = std::max<std::size_t>(size, 1);
+  while (true) {
+    void *ptr = alignment > alignof(std::max_align_t)
+                    ? std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)
+                    : std::malloc(size);
+    if (ptr != nullptr) {
+      CountAllocation(ptr, size);
+      return ptr;
+    }
+    auto handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void *AllocateNoThrow(std::size_t size, std::size_t alignment) noexcept {
+  try {
+    return Allocate(size, alignment);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void Deallocate(void *ptr) noexcept {
+  CountDeallocation(ptr);
+  std::free(ptr);
+}
+#endif
+
+// Peak RSS is reset before measured run if kernel supports it (Linux 4.0+), otherwise it is process-wide
+void ResetPeakRss() {
+#ifdef __linux__
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  clear_refs << "5";
+#endif
+}
+
+uint64_t ReadPeakRss() {
+#ifdef __linux__
+  std::ifstream status("/proc/self/status");
+  std::string key;
+  uint64_t value = 0;
+  while (status >> key) {
+    if (key == "VmHWM:" && status >> value) {
+      return value * 1024;
+    }
+  }
+  rusage usage{};
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+  }
+#endif
+  return 0;
+}
+
+}  // namespace
+
+#if PPC_ALLOC_COUNTERS
+void *operator new(std::size_t size) { return Allocate(size, 0); }
+void *operator new[](std::size_t size) { return Allocate(size, 0); }
+void *operator new(std::size_t size, std::align_val_t alignment) {
+  return Allocate(size, static_cast<std::size_t>(alignment));
+}
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+  return Allocate(size, static_cast<std::size_t>(alignment));
+}
+void *operator new(std::size_t size, const std::nothrow_t & /*tag*/) noexcept { return AllocateNoThrow(size, 0); }
+void *operator new[](std::size_t size, const std::nothrow_t & /*tag*/) noexcept { return AllocateNoThrow(size, 0); }
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t & /*tag*/) noexcept {
+  return AllocateNoThrow(size, static_cast<std::size_t>(alignment));
+}
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t & /*tag*/) noexcept {
+  return AllocateNoThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *ptr) noexcept { Deallocate(ptr); }
+void operator delete[](void *ptr) noexcept { Deallocate(ptr); }
+void operator delete(void *ptr, std::size_t /*size*/) noexcept { Deallocate(ptr); }
+void operator delete[](void *ptr, std::size_t /*size*/) noexcept { Deallocate(ptr); }
+void operator delete(void *ptr, std::align_val_t /*alignment*/) noexcept { Deallocate(ptr); }
+void operator delete[](void *ptr, std::align_val_t /*alignment*/) noexcept { Deallocate(ptr); }
+void operator delete(void *ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept { Deallocate(ptr); }
+void operator delete[](void *ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept { Deallocate(ptr); }
+void operator delete(void *ptr, const std::nothrow_t & /*tag*/) noexcept { Deallocate(ptr); }
+void operator delete[](void *ptr, const std::nothrow_t & /*tag*/) noexcept { Deallocate(ptr); }
+void operator delete(void *ptr, std::align_val_t /*alignment*/, const std::nothrow_t & /*tag*/) noexcept {
+  Deallocate(ptr);
+}
+void operator delete[](void *ptr, std::align_val_t /*alignment*/, const std::nothrow_t & /*tag*/) noexcept {
+  Deallocate(ptr);
+}
+#endif
+
+ppc::core::AllocCounterGroup::~AllocCounterGroup() {
+  if (running_) {
+    Stop();
+  }
+}
+
+bool ppc::core::AllocCounterGroup::IsAvailable() { return PPC_ALLOC_COUNTERS != 0; }
+
+void ppc::core::AllocCounterGroup::Start() {
+  if (!IsAvailable() || running_) {
+    return;
+  }
+  ResetPeakRss();
+  start_allocations_ = total_allocations.load();
+  start_bytes_ = total_bytes.load();
+  start_live_bytes_ = live_bytes.load();
+  peak_live_bytes.store(start_live_bytes_);
+  running_ = true;
+  active_groups.fetch_add(1);
+}
+
+void ppc::core::AllocCounterGroup::Stop() {
+  if (!running_) {
+    return;
+  }
+  active_groups.fetch_sub(1);
+  running_ = false;
+  counters_.available = true;
+  counters_.num_allocations += total_allocations.load() - start_allocations_;
+  counters_.bytes_allocated += total_bytes.load() - start_bytes_;
+  auto peak = std::max<int64_t>(peak_live_bytes.load() - start_live_bytes_, 0);
+  counters_.peak_heap_bytes = std::max(counters_.peak_heap_bytes, static_cast<uint64_t>(peak));
+  counters_.peak_rss_bytes = std::max(counters_.peak_rss_bytes, ReadPeakRss());
+}
+
+ppc::core::AllocCounters ppc::core::AllocCounterGroup::Read() const { return counters_; }
@@ -0,0 +1,139 @@
+#include "core/perf/include/hw_counters.hpp"
+
+#include <cstdint>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+#endif
+
+namespace {
+
+#ifdef __linux__
+int OpenCounter(pid_t tid, uint32_t type, uint64_t config) {
+  perf_event_attr attr{};
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = 1;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // Counters of many threads may be multiplexed on hardware, enabled and running times are used to scale them
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, -1, 0));
+}
+
+// Calling thread first, so counters of the process are available iff counters of the calling thread are
+std::vector<pid_t> ThreadsOfProcess() {
+  auto self = static_cast<pid_t>(syscall(SYS_gettid));
+  std::vector<pid_t> tids = {self};
+  std::error_code ec;
+  for (const auto &entry : std::filesystem::directory_iterator("/proc/self/task", ec)) {
+    auto tid = static_cast<pid_t>(std::stol(entry.path().filename().string()));
+    if (tid != self) {
+      tids.push_back(tid);
+    }
+  }
+  return tids;
+}
+
+uint64_t ReadCounter(int fd) {
+  std::array<uint64_t, 3> data{};  // value, time enabled, time running
+  if (fd < 0 || read(fd, data.data(), sizeof(data)) != static_cast<ssize_t>(sizeof(data))) {
+    return 0;
+  }
+  auto [value, enabled, running] = data;
+  if (running == 0 || running >= enabled) {
+    return value;
+  }
+  return static_cast<uint64_t>(static_cast<double>(value) * static_cast<double>(enabled) /
+                               static_cast<double>(running));
+}
+#endif
+
+}  // namespace
+
+ppc::core::HwCounterGroup::HwCounterGroup() {
+#ifdef __linux__
+  for (auto tid : ThreadsOfProcess()) {
+    Fds fds;
+    fds[kCycles] = OpenCounter(tid, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    fds[kInstructions] = OpenCounter(tid, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    fds[kLlcMisses] = OpenCounter(tid, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    fds[kBranchMisses] = OpenCounter(tid, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    for (auto fd : fds) {
+      if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      }
+    }
+    threads_.push_back(fds);
+  }
+#endif
+}
+
+ppc::core::HwCounterGroup::~HwCounterGroup() {
+#ifdef __linux__
+  for (const auto &fds : threads_) {
+    for (auto fd : fds) {
+      if (fd >= 0) {
+        close(fd);
+      }
+    }
+  }
+#endif
+}
+
+bool ppc::core::HwCounterGroup::IsAvailable() const {
+  return !threads_.empty() && (threads_.front()[kCycles] >= 0 || threads_.front()[kInstructions] >= 0);
+}
+
+void ppc::core::HwCounterGroup::Start() {
+#ifdef __linux__
+  for (const auto &fds : threads_) {
+    for (auto fd : fds) {
+      if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+  }
+#endif
+}
+
+void ppc::core::HwCounterGroup::Stop() {
+#ifdef __linux__
+  for (const auto &fds : threads_) {
+    for (auto fd : fds) {
+      if (fd >= 0) {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      }
+    }
+  }
+#endif
+}
+
+ppc::core::HwCounters ppc::core::HwCounterGroup::Read() const {
+  HwCounters counters;
+  counters.available = IsAvailable();
+#ifdef __linux__
+  // Counter of exited thread keeps its final value, so threads which finished before Read are summed too
+  for (const auto &fds : threads_) {
+    counters.cycles += ReadCounter(fds[kCycles]);
+    counters.instructions += ReadCounter(fds[kInstructions]);
+    counters.llc_misses += ReadCounter(fds[kLlcMisses]);
+    counters.branch_misses += ReadCounter(fds[kBranchMisses]);
+  }
+#endif
+  return counters;
+}
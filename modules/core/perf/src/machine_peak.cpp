@@ -0,0 +1,101 @@
+#include "core/perf/include/machine_peak.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <numeric>
+
+#include "core/util/include/thread_pool.hpp"
+
+namespace {
+
+constexpr int kRepeats = 5;
+constexpr size_t kFmaChains = 32;
+constexpr size_t kFmaIterations = size_t{1} << 22;
+
+// Prevents elimination of benchmark results
+std::atomic<double> sink{0.0};
+
+template <class Body>
+double BestTime(Body &&body) {
+  double best = std::numeric_limits<double>::max();
+  for (int i = 0; i < kRepeats; i++) {
+    auto begin = std::chrono::steady_clock::now();
+    body();
+    best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count());
+  }
+  return best;
+}
+
+double FmaKernel(size_t iterations) {
+  std::array<double, kFmaChains> acc{};
+  for (size_t k = 0; k < kFmaChains; k++) {
+    acc[k] = 1.0 + (static_cast<double>(k) * 1e-3);
+  }
+  const double mul = 0.999999;
+  const double add = 1e-6;
+  for (size_t it = 0; it < iterations; it++) {
+    for (auto &value : acc) {
+      value = (value * mul) + add;
+    }
+  }
+  return std::accumulate(acc.begin(), acc.end(), 0.0);
+}
+
+}  // namespace
+
+ppc::core::MachinePeak ppc::core::MeasureMachinePeak(size_t stream_bytes) {
+  auto &pool = ppc::util::ThreadPool::Global();
+  MachinePeak peak;
+  peak.num_threads = pool.NumThreads();
+
+  // Arrays are first touched by the same pool and chunks as the triad, so pages of a chunk are placed on NUMA node of
+  // a thread which runs it. Pool claims chunks dynamically, so locality is likely but not guaranteed
+  size_t count = std::max<size_t>(stream_bytes / (3 * sizeof(double)), 1);
+  size_t grain = (count + peak.num_threads - 1) / peak.num_threads;
+  auto for_each_chunk = [&](auto &&body) {
+    pool.ParallelForRange(
+        0, count,
+        [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; i++) {
+            body(i);
+          }
+        },
+        grain);
+  };
+  auto a = std::make_unique_for_overwrite<double[]>(count);
+  auto b = std::make_unique_for_overwrite<double[]>(count);
+  auto c = std::make_unique_for_overwrite<double[]>(count);
+  for_each_chunk([&](size_t i) {
+    a[i] = 0.0;
+    b[i] = 1.0;
+    c[i] = 2.0;
+  });
+  const double scalar = 3.0;
+  double stream_time = BestTime([&] { for_each_chunk([&](size_t i) { a[i] = b[i] + (scalar * c[i]); }); });
+  sink.fetch_add(a[count / 2]);
+  peak.gbytes_per_sec = static_cast<double>(3 * count * sizeof(double)) / stream_time * 1e-9;
+
+  double fma_time = BestTime([&] {
+    pool.ParallelForRange(
+        0, peak.num_threads,
+        [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; i++) {
+            sink.fetch_add(FmaKernel(kFmaIterations));
+          }
+        },
+        1);
+  });
+  auto flops = 2.0 * static_cast<double>(kFmaChains * kFmaIterations * peak.num_threads);
+  peak.gflops = flops / fma_time * 1e-9;
+  return peak;
+}
+
+const ppc::core::MachinePeak &ppc::core::GetMachinePeak() {
+  static const MachinePeak kPeak = MeasureMachinePeak();
+  return kPeak;
+}
@@ -0,0 +1,23 @@
+#include "core/perf/include/output_digest.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+uint64_t ppc::core::DigestBytes(const void *data, size_t size, uint64_t seed) {
+  constexpr uint64_t kPrime = 1099511628211ULL;
+  const auto *bytes = static_cast<const unsigned char *>(data);
+  uint64_t digest = seed;
+  for (size_t i = 0; i < size; i++) {
+    digest = (digest ^ bytes[i]) * kPrime;
+  }
+  return digest;
+}
+
+std::string ppc::core::DigestToString(uint64_t digest) {
+  std::stringstream res;
+  res << std::hex << std::setw(16) << std::setfill('0') << digest;
+  return res.str();
+}
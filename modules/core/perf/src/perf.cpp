@@ -2,16 +2,28 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <numeric>
+#include <random>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
+#include "core/perf/include/alloc_counters.hpp"
+#include "core/perf/include/hw_counters.hpp"
+#include "core/perf/include/machine_peak.hpp"
+#include "core/perf/include/output_digest.hpp"
+#include "core/perf/include/perf_report.hpp"
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
 
 ppc::core::Perf::Perf(const std::shared_ptr<Task>& task_ptr) { SetTask(task_ptr); }
 
@@ -20,9 +32,15 @@ void ppc::core::Perf::SetTask(const std::shared_ptr<Task>& task_ptr) {
   this->task_ = task_ptr;
 }
 
+uint64_t ppc::core::Perf::GetInputSize() const {
+  const auto& inputs_count = task_->GetData()->inputs_count;
+  return std::accumulate(inputs_count.begin(), inputs_count.end(), static_cast<uint64_t>(0));
+}
+
 void ppc::core::Perf::PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr,
                                   const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kPipeline;
+  perf_results->input_size = GetInputSize();
 
   CommonRun(
       perf_attr,
@@ -33,11 +51,15 @@ void ppc::core::Perf::PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr,
         task_->PostProcessing();
       },
       perf_results);
+  if (perf_attr->output_digest) {
+    perf_results->output_digest = DigestToString(perf_attr->output_digest());
+  }
 }
 
 void ppc::core::Perf::TaskRun(const std::shared_ptr<PerfAttr>& perf_attr,
                               const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kTaskRun;
+  perf_results->input_size = GetInputSize();
 
   task_->Validation();
   task_->PreProcessing();
@@ -48,16 +70,150 @@ void ppc::core::Perf::TaskRun(const std::shared_ptr<PerfAttr>& perf_attr,
   task_->PreProcessing();
   task_->Run();
   task_->PostProcessing();
+  if (perf_attr->output_digest) {
+    perf_results->output_digest = DigestToString(perf_attr->output_digest());
+  }
 }
 
 void ppc::core::Perf::CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
-                                const std::shared_ptr<ppc::core::PerfResults>& perf_results) {
-  auto begin = perf_attr->current_timer();
-  for (uint64_t i = 0; i < perf_attr->num_running; i++) {
+                                const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
+  // Counters are opened for every existing thread and inherited by threads created later, so pool workers are counted
+  // whether they were started before this run or by its warmup
+  std::unique_ptr<HwCounterGroup> hw_counters;
+  if (perf_attr->use_hw_counters || ppc::util::GetEnvVariable("PPC_PERF_HW_COUNTERS") == "1") {
+    hw_counters = std::make_unique<HwCounterGroup>();
+  }
+  std::unique_ptr<AllocCounterGroup> alloc_counters;
+  if (perf_attr->count_allocations || ppc::util::GetEnvVariable("PPC_PERF_ALLOC_COUNTERS") == "1") {
+    alloc_counters = std::make_unique<AllocCounterGroup>();
+  }
+
+  auto run_once = [&]() {
+    if (alloc_counters) {
+      alloc_counters->Start();
+    }
+    if (hw_counters) {
+      hw_counters->Start();
+    }
+    auto begin = perf_attr->current_timer();
     pipeline();
+    auto end = perf_attr->current_timer();
+    if (hw_counters) {
+      hw_counters->Stop();
+    }
+    if (alloc_counters) {
+      alloc_counters->Stop();
+    }
+    return end - begin;
+  };
+
+  for (uint64_t i = 0; i < perf_attr->num_warmup; i++) {
+    pipeline();
+  }
+  task_->ResetPhaseTimings();
+
+  perf_results->samples.clear();
+  uint64_t num_running = perf_attr->num_running;
+  if (perf_attr->target_time_sec > 0.0) {
+    // First measured run is used as estimation of single run time
+    perf_results->samples.push_back(run_once());
+    auto first_time = perf_results->samples.front();
+    num_running = perf_attr->max_num_running;
+    if (first_time > 0.0) {
+      num_running = std::clamp(static_cast<uint64_t>(std::ceil(perf_attr->target_time_sec / first_time)),
+                               static_cast<uint64_t>(1), perf_attr->max_num_running);
+    }
+  }
+
+  perf_results->samples.reserve(num_running);
+  while (perf_results->samples.size() < num_running) {
+    perf_results->samples.push_back(run_once());
+  }
+
+  perf_results->max_time_sec = perf_attr->max_time_sec > 0.0
+                                    ? perf_attr->max_time_sec
+                                    : ppc::util::GetEnvDouble("PPC_PERF_MAX_TIME", PerfResults::kMaxTime);
+  perf_results->record_time_limit = perf_attr->record_time_limit || ppc::util::IsTimeLimitRecorded();
+
+  perf_results->num_running = perf_results->samples.size();
+  perf_results->num_warmup = perf_attr->num_warmup;
+  perf_results->time_sec = std::accumulate(perf_results->samples.begin(), perf_results->samples.end(), 0.0);
+  CalcStatistics(perf_results);
+  perf_results->phase_timings = task_->GetPhaseTimings();
+
+  perf_results->hw_counters = hw_counters ? hw_counters->Read() : HwCounters{};
+  const auto& counters = perf_results->hw_counters;
+  perf_results->ipc = counters.cycles > 0
+                          ? static_cast<double>(counters.instructions) / static_cast<double>(counters.cycles)
+                          : 0.0;
+  auto processed_elements = static_cast<double>(perf_results->num_running * perf_results->input_size);
+  if (processed_elements > 0.0) {
+    perf_results->llc_misses_per_element = static_cast<double>(counters.llc_misses) / processed_elements;
+    perf_results->branch_misses_per_element = static_cast<double>(counters.branch_misses) / processed_elements;
   }
-  auto end = perf_attr->current_timer();
-  perf_results->time_sec = end - begin;
+
+  perf_results->alloc_counters = alloc_counters ? alloc_counters->Read() : AllocCounters{};
+  const auto& allocs = perf_results->alloc_counters;
+  auto num_runs = static_cast<double>(perf_results->num_running);
+  perf_results->allocations_per_run = num_runs > 0.0 ? static_cast<double>(allocs.num_allocations) / num_runs : 0.0;
+  perf_results->bytes_allocated_per_run = num_runs > 0.0 ? static_cast<double>(allocs.bytes_allocated) / num_runs : 0.0;
+
+  CalcThroughput(perf_attr, perf_results);
+}
+
+void ppc::core::Perf::CalcThroughput(const std::shared_ptr<PerfAttr>& perf_attr,
+                                     const std::shared_ptr<PerfResults>& perf_results) const {
+  auto& res = *perf_results;
+  res.work = task_->EstimateWork();
+  // Work is declared for Run(), so its own time is used in pipeline mode too
+  double run_sec = res.phase_timings.run.calls > 0 ? res.phase_timings.run.MeanSec() : res.mean_sec;
+  if (run_sec <= 0.0 || (res.work.flops <= 0.0 && res.work.bytes <= 0.0)) {
+    return;
+  }
+  res.gflops = res.work.flops / run_sec * 1e-9;
+  res.gbytes_per_sec = res.work.bytes / run_sec * 1e-9;
+  res.arithmetic_intensity = res.work.bytes > 0.0 ? res.work.flops / res.work.bytes : 0.0;
+
+  if (!perf_attr->measure_machine_peak && ppc::util::GetEnvVariable("PPC_PERF_MACHINE_PEAK") != "1") {
+    return;
+  }
+  const auto& peak = GetMachinePeak();
+  res.peak_gflops = peak.gflops;
+  res.peak_gbytes_per_sec = peak.gbytes_per_sec;
+  double bound = res.work.bytes > 0.0 ? std::min(peak.gflops, res.arithmetic_intensity * peak.gbytes_per_sec)
+                                      : peak.gflops;
+  res.roofline_efficiency = bound > 0.0 ? res.gflops / bound : 0.0;
+  res.bandwidth_efficiency = peak.gbytes_per_sec > 0.0 ? res.gbytes_per_sec / peak.gbytes_per_sec : 0.0;
+}
+
+void ppc::core::Perf::CalcStatistics(const std::shared_ptr<PerfResults>& perf_results) {
+  if (perf_results->samples.empty()) {
+    return;
+  }
+  std::vector<double> sorted(perf_results->samples);
+  std::ranges::sort(sorted);
+  auto count = static_cast<double>(sorted.size());
+
+  // Percentile with linear interpolation between closest ranks
+  auto percentile = [&](double p) {
+    double rank = p * (count - 1.0);
+    auto lower = static_cast<size_t>(std::floor(rank));
+    auto upper = static_cast<size_t>(std::ceil(rank));
+    return sorted[lower] + ((rank - static_cast<double>(lower)) * (sorted[upper] - sorted[lower]));
+  };
+
+  perf_results->min_sec = sorted.front();
+  perf_results->max_sec = sorted.back();
+  perf_results->mean_sec = std::accumulate(sorted.begin(), sorted.end(), 0.0) / count;
+  perf_results->median_sec = percentile(0.5);
+  perf_results->p90_sec = percentile(0.9);
+  perf_results->p99_sec = percentile(0.99);
+
+  double sq_sum = 0.0;
+  for (auto sample : sorted) {
+    sq_sum += (sample - perf_results->mean_sec) * (sample - perf_results->mean_sec);
+  }
+  perf_results->stddev_sec = sorted.size() > 1 ? std::sqrt(sq_sum / (count - 1.0)) : 0.0;
 }
 
 void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results) {
@@ -67,6 +223,7 @@ void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& per
   std::string type_test_name;
 
   auto time_secs = perf_results->time_sec;
+  perf_results->time_limit_exceeded = time_secs >= perf_results->max_time_sec;
 
   if (perf_results->type_of_running == PerfResults::TypeOfRunning::kTaskRun) {
     type_test_name = "task_run";
@@ -82,17 +239,82 @@ void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& per
   auto last_found_position = relative_path.find(perf_regex_template) - 1;
   relative_path.erase(last_found_position, relative_path.length() - 1);
 
+  PerfReport::AppendFromEnv(PerfReport::MakeRecord(*perf_results));
+
   std::stringstream perf_res_str;
-  if (time_secs < PerfResults::kMaxTime) {
+  if (!perf_results->time_limit_exceeded || perf_results->record_time_limit) {
+    if (perf_results->time_limit_exceeded) {
+      std::cout << relative_path << ":" << type_test_name << ":time_limit_exceeded" << std::fixed
+                << std::setprecision(4) << " max_time=" << perf_results->max_time_sec << '\n';
+    }
     perf_res_str << std::fixed << std::setprecision(10) << time_secs;
     std::cout << relative_path << ":" << type_test_name << ":" << perf_res_str.str() << '\n';
+    if (perf_results->num_running > 1) {
+      std::cout << relative_path << ":" << type_test_name << ":stats" << std::scientific << std::setprecision(4)
+                << " runs=" << perf_results->num_running << " warmup=" << perf_results->num_warmup
+                << " min=" << perf_results->min_sec << " median=" << perf_results->median_sec
+                << " p90=" << perf_results->p90_sec << " p99=" << perf_results->p99_sec
+                << " stddev=" << perf_results->stddev_sec << '\n';
+    }
+    const auto& phases = perf_results->phase_timings;
+    std::cout << relative_path << ":" << type_test_name << ":phases" << std::scientific << std::setprecision(4)
+              << " validation=" << phases.validation.MeanSec()
+              << " pre_processing=" << phases.pre_processing.MeanSec() << " run=" << phases.run.MeanSec()
+              << " post_processing=" << phases.post_processing.MeanSec() << '\n';
+    if (perf_results->hw_counters.available) {
+      std::cout << relative_path << ":" << type_test_name << ":hw_counters" << std::fixed << std::setprecision(4)
+                << " ipc=" << perf_results->ipc << " cycles=" << perf_results->hw_counters.cycles
+                << " instructions=" << perf_results->hw_counters.instructions
+                << " llc_misses_per_element=" << perf_results->llc_misses_per_element
+                << " branch_misses_per_element=" << perf_results->branch_misses_per_element << '\n';
+    }
+    if (perf_results->gflops > 0.0 || perf_results->gbytes_per_sec > 0.0) {
+      std::cout << relative_path << ":" << type_test_name << ":roofline" << std::fixed << std::setprecision(4)
+                << " gflops=" << perf_results->gflops << " gbytes_per_sec=" << perf_results->gbytes_per_sec
+                << " intensity=" << perf_results->arithmetic_intensity;
+      if (perf_results->peak_gflops > 0.0) {
+        std::cout << " peak_gflops=" << perf_results->peak_gflops
+                  << " peak_gbytes_per_sec=" << perf_results->peak_gbytes_per_sec
+                  << " roofline_efficiency=" << perf_results->roofline_efficiency
+                  << " bandwidth_efficiency=" << perf_results->bandwidth_efficiency;
+      }
+      std::cout << '\n';
+    }
+    if (!perf_results->output_digest.empty()) {
+      std::cout << relative_path << ":" << type_test_name << ":output_digest " << perf_results->output_digest << '\n';
+    }
+    if (perf_results->alloc_counters.available) {
+      const auto& allocs = perf_results->alloc_counters;
+      std::cout << relative_path << ":" << type_test_name << ":memory" << std::fixed << std::setprecision(1)
+                << " allocations_per_run=" << perf_results->allocations_per_run
+                << " bytes_allocated_per_run=" << perf_results->bytes_allocated_per_run
+                << " peak_heap_bytes=" << allocs.peak_heap_bytes << " peak_rss_bytes=" << allocs.peak_rss_bytes
+                << '\n';
+    }
   } else {
     std::stringstream err_msg;
     err_msg << '\n' << "Task execute time need to be: ";
-    err_msg << "time < " << PerfResults::kMaxTime << " secs." << '\n';
+    err_msg << "time < " << perf_results->max_time_sec << " secs." << '\n';
     err_msg << "Original time in secs: " << time_secs << '\n';
     perf_res_str << std::fixed << std::setprecision(10) << -1.0;
     std::cout << relative_path << ":" << type_test_name << ":" << perf_res_str.str() << '\n';
     throw std::runtime_error(err_msg.str().c_str());
   }
 }
+
+std::vector<uint64_t> ppc::core::GetPerfSizes(std::vector<uint64_t> default_sizes) {
+  auto sizes = ppc::util::GetEnvList("PPC_PERF_SIZES");
+  return sizes.empty() ? default_sizes : sizes;
+}
+
+std::vector<uint64_t> ppc::core::GetPerfSizes(uint64_t default_size) {
+  return GetPerfSizes(std::vector<uint64_t>{default_size});
+}
+
+uint64_t ppc::core::GetPerfSeed() {
+  auto seed = ppc::util::GetEnvList("PPC_PERF_SEED");
+  if (seed.size() > 1) {
+    throw std::invalid_argument("PPC_PERF_SEED must be a single number");
+  }
+  return seed.empty() ? std::random_device{}() : seed.front();
+}
@@ -0,0 +1,290 @@
+#include "core/perf/include/perf_report.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include "core/perf/include/perf.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+std::string EscapeJson(const std::string& str) {
+  std::stringstream res;
+  for (char c : str) {
+    switch (c) {
+      case '"':
+        res << "\\\"";
+        break;
+      case '\\':
+        res << "\\\\";
+        break;
+      case '\n':
+        res << "\\n";
+        break;
+      case '\t':
+        res << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          res << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+          res << c;
+        }
+    }
+  }
+  return res.str();
+}
+
+std::string EscapeCsv(const std::string& str) {
+  if (str.find_first_of(",\"\n") == std::string::npos) {
+    return str;
+  }
+  std::string res = "\"";
+  for (char c : str) {
+    if (c == '"') {
+      res += '"';
+    }
+    res += c;
+  }
+  return res + "\"";
+}
+
+std::string TypeOfRunningName(ppc::core::PerfResults::TypeOfRunning type) {
+  switch (type) {
+    case ppc::core::PerfResults::TypeOfRunning::kPipeline:
+      return "pipeline";
+    case ppc::core::PerfResults::TypeOfRunning::kTaskRun:
+      return "task_run";
+    case ppc::core::PerfResults::TypeOfRunning::kNone:
+      return "none";
+  }
+  return "none";
+}
+
+std::string ReadCpuModel() {
+  std::ifstream cpuinfo("/proc/cpuinfo");
+  std::string line;
+  while (std::getline(cpuinfo, line)) {
+    if (line.rfind("model name", 0) == 0) {
+      auto pos = line.find(':');
+      if (pos != std::string::npos && pos + 2 <= line.size()) {
+        return line.substr(pos + 2);
+      }
+    }
+  }
+  return "unknown";
+}
+
+std::string ReadHostname() {
+#ifndef _WIN32
+  std::vector<char> buffer(256, '\0');
+  if (gethostname(buffer.data(), buffer.size() - 1) == 0) {
+    return {buffer.data()};
+  }
+  return "unknown";
+#else
+  auto name = ppc::util::GetEnvVariable("COMPUTERNAME");
+  return name.empty() ? "unknown" : name;
+#endif
+}
+
+std::string CompilerName() {
+  std::stringstream res;
+#if defined(__clang__)
+  res << "clang " << __clang_major__ << "." << __clang_minor__ << "." << __clang_patchlevel__;
+#elif defined(__GNUC__)
+  res << "gcc " << __GNUC__ << "." << __GNUC_MINOR__ << "." << __GNUC_PATCHLEVEL__;
+#elif defined(_MSC_VER)
+  res << "msvc " << _MSC_VER;
+#else
+  res << "unknown";
+#endif
+  return res.str();
+}
+
+}  // namespace
+
+const ppc::core::HardwareInfo& ppc::core::PerfReport::GetHardwareInfo() {
+  static const HardwareInfo kInfo = [] {
+    HardwareInfo info;
+    info.cpu_model = ReadCpuModel();
+    info.hostname = ReadHostname();
+    info.compiler = CompilerName();
+    info.hardware_threads = std::thread::hardware_concurrency();
+    return info;
+  }();
+  return kInfo;
+}
+
+void ppc::core::PerfReport::ParseTestPath(const std::string& path, std::string& technology,
+                                          std::string& task_name) {
+  std::vector<std::string> parts;
+  for (const auto& part : std::filesystem::path(path)) {
+    parts.push_back(part.string());
+  }
+  technology = "unknown";
+  task_name = "unknown";
+  for (size_t i = parts.size(); i-- > 2;) {
+    if (parts[i] == "perf_tests" || parts[i] == "func_tests") {
+      technology = parts[i - 2];
+      task_name = parts[i - 1];
+      return;
+    }
+  }
+}
+
+ppc::core::PerfRecord ppc::core::PerfReport::MakeRecord(const PerfResults& perf_results) {
+  PerfRecord record;
+  const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+  if (test_info != nullptr) {
+    ParseTestPath(test_info->file(), record.technology, record.task_name);
+    record.test_name = std::string(test_info->test_suite_name()) + "." + test_info->name();
+  }
+  record.type_of_running = TypeOfRunningName(perf_results.type_of_running);
+  record.num_threads = ppc::util::GetPPCNumThreads();
+  record.results = perf_results;
+  record.hardware = GetHardwareInfo();
+  return record;
+}
+
+std::string ppc::core::PerfReport::ToJson(const PerfRecord& record) {
+  const auto& res = record.results;
+  std::stringstream json;
+  json << std::setprecision(10);
+  json << "{\"task\":\"" << EscapeJson(record.task_name) << "\"";
+  json << ",\"technology\":\"" << EscapeJson(record.technology) << "\"";
+  json << ",\"test\":\"" << EscapeJson(record.test_name) << "\"";
+  json << ",\"type_of_running\":\"" << EscapeJson(record.type_of_running) << "\"";
+  json << ",\"num_threads\":" << record.num_threads;
+  json << ",\"input_size\":" << res.input_size;
+  json << ",\"num_running\":" << res.num_running;
+  json << ",\"num_warmup\":" << res.num_warmup;
+  json << ",\"time_sec\":" << res.time_sec;
+  json << ",\"min_sec\":" << res.min_sec;
+  json << ",\"max_sec\":" << res.max_sec;
+  json << ",\"mean_sec\":" << res.mean_sec;
+  json << ",\"median_sec\":" << res.median_sec;
+  json << ",\"p90_sec\":" << res.p90_sec;
+  json << ",\"p99_sec\":" << res.p99_sec;
+  json << ",\"stddev_sec\":" << res.stddev_sec;
+  json << ",\"max_time_sec\":" << res.max_time_sec;
+  json << ",\"time_limit_exceeded\":" << (res.time_limit_exceeded ? "true" : "false");
+  json << ",\"output_digest\":\"" << res.output_digest << "\"";
+  json << ",\"samples\":[";
+  for (size_t i = 0; i < res.samples.size(); i++) {
+    json << (i == 0 ? "" : ",") << res.samples[i];
+  }
+  json << "]";
+  json << ",\"phases\":{\"validation_sec\":" << res.phase_timings.validation.MeanSec();
+  json << ",\"pre_processing_sec\":" << res.phase_timings.pre_processing.MeanSec();
+  json << ",\"run_sec\":" << res.phase_timings.run.MeanSec();
+  json << ",\"post_processing_sec\":" << res.phase_timings.post_processing.MeanSec() << "}";
+  json << ",\"hw_counters\":{\"available\":" << (res.hw_counters.available ? "true" : "false");
+  json << ",\"cycles\":" << res.hw_counters.cycles;
+  json << ",\"instructions\":" << res.hw_counters.instructions;
+  json << ",\"llc_misses\":" << res.hw_counters.llc_misses;
+  json << ",\"branch_misses\":" << res.hw_counters.branch_misses;
+  json << ",\"ipc\":" << res.ipc;
+  json << ",\"llc_misses_per_element\":" << res.llc_misses_per_element;
+  json << ",\"branch_misses_per_element\":" << res.branch_misses_per_element << "}";
+  json << ",\"throughput\":{\"flops\":" << res.work.flops;
+  json << ",\"bytes\":" << res.work.bytes;
+  json << ",\"gflops\":" << res.gflops;
+  json << ",\"gbytes_per_sec\":" << res.gbytes_per_sec;
+  json << ",\"arithmetic_intensity\":" << res.arithmetic_intensity;
+  json << ",\"peak_gflops\":" << res.peak_gflops;
+  json << ",\"peak_gbytes_per_sec\":" << res.peak_gbytes_per_sec;
+  json << ",\"roofline_efficiency\":" << res.roofline_efficiency;
+  json << ",\"bandwidth_efficiency\":" << res.bandwidth_efficiency << "}";
+  json << ",\"memory\":{\"available\":" << (res.alloc_counters.available ? "true" : "false");
+  json << ",\"num_allocations\":" << res.alloc_counters.num_allocations;
+  json << ",\"bytes_allocated\":" << res.alloc_counters.bytes_allocated;
+  json << ",\"allocations_per_run\":" << res.allocations_per_run;
+  json << ",\"bytes_allocated_per_run\":" << res.bytes_allocated_per_run;
+  json << ",\"peak_heap_bytes\":" << res.alloc_counters.peak_heap_bytes;
+  json << ",\"peak_rss_bytes\":" << res.alloc_counters.peak_rss_bytes << "}";
+  json << ",\"hardware\":{\"cpu_model\":\"" << EscapeJson(record.hardware.cpu_model) << "\"";
+  json << ",\"hostname\":\"" << EscapeJson(record.hardware.hostname) << "\"";
+  json << ",\"compiler\":\"" << EscapeJson(record.hardware.compiler) << "\"";
+  json << ",\"hardware_threads\":" << record.hardware.hardware_threads << "}";
+  json << "}";
+  return json.str();
+}
+
+std::string ppc::core::PerfReport::CsvHeader() {
+  return "task,technology,test,type_of_running,num_threads,input_size,num_running,num_warmup,time_sec,min_sec,"
+         "max_sec,mean_sec,median_sec,p90_sec,p99_sec,stddev_sec,max_time_sec,time_limit_exceeded,output_digest,"
+         "validation_sec,pre_processing_sec,run_sec,post_processing_sec,cycles,instructions,llc_misses,branch_misses,"
+         "ipc,gflops,gbytes_per_sec,arithmetic_intensity,peak_gflops,peak_gbytes_per_sec,roofline_efficiency,"
+         "bandwidth_efficiency,allocations_per_run,bytes_allocated_per_run,peak_heap_bytes,peak_rss_bytes,"
+         "cpu_model,hostname,compiler,hardware_threads";
+}
+
+std::string ppc::core::PerfReport::ToCsv(const PerfRecord& record) {
+  const auto& res = record.results;
+  std::stringstream csv;
+  csv << std::setprecision(10);
+  csv << EscapeCsv(record.task_name) << "," << EscapeCsv(record.technology) << "," << EscapeCsv(record.test_name)
+      << "," << EscapeCsv(record.type_of_running) << "," << record.num_threads << "," << res.input_size << ","
+      << res.num_running << "," << res.num_warmup << "," << res.time_sec << "," << res.min_sec << ","
+      << res.max_sec << "," << res.mean_sec << "," << res.median_sec << "," << res.p90_sec << "," << res.p99_sec
+      << "," << res.stddev_sec << "," << res.max_time_sec << "," << (res.time_limit_exceeded ? 1 : 0) << ","
+      << res.output_digest << ","
+      << res.phase_timings.validation.MeanSec() << ","
+      << res.phase_timings.pre_processing.MeanSec() << "," << res.phase_timings.run.MeanSec() << ","
+      << res.phase_timings.post_processing.MeanSec() << "," << res.hw_counters.cycles << ","
+      << res.hw_counters.instructions << "," << res.hw_counters.llc_misses << "," << res.hw_counters.branch_misses
+      << "," << res.ipc << "," << res.gflops << "," << res.gbytes_per_sec << "," << res.arithmetic_intensity << ","
+      << res.peak_gflops << "," << res.peak_gbytes_per_sec << "," << res.roofline_efficiency << ","
+      << res.bandwidth_efficiency << "," << res.allocations_per_run << "," << res.bytes_allocated_per_run << ","
+      << res.alloc_counters.peak_heap_bytes << "," << res.alloc_counters.peak_rss_bytes << ","
+      << EscapeCsv(record.hardware.cpu_model) << "," << EscapeCsv(record.hardware.hostname)
+      << "," << EscapeCsv(record.hardware.compiler) << "," << record.hardware.hardware_threads;
+  return csv.str();
+}
+
+void ppc::core::PerfReport::Append(const std::string& path, Format format, const PerfRecord& record) {
+  std::error_code ec;
+  bool is_empty = !std::filesystem::exists(path, ec) || std::filesystem::file_size(path, ec) == 0;
+  std::ofstream file(path, std::ios::app);
+  if (!file.is_open()) {
+    throw std::runtime_error("Can't open perf report file: " + path);
+  }
+  if (format == Format::kCsv) {
+    if (is_empty) {
+      file << CsvHeader() << '\n';
+    }
+    file << ToCsv(record) << '\n';
+  } else {
+    file << ToJson(record) << '\n';
+  }
+}
+
+void ppc::core::PerfReport::AppendFromEnv(const PerfRecord& record) {
+  auto path = ppc::util::GetEnvVariable("PPC_PERF_REPORT_FILE");
+  if (path.empty()) {
+    return;
+  }
+  auto format_name = ppc::util::GetEnvVariable("PPC_PERF_REPORT_FORMAT");
+  Format format = Format::kJson;
+  if (format_name == "csv") {
+    format = Format::kCsv;
+  } else if (!format_name.empty() && format_name != "json") {
+    throw std::runtime_error("Unknown PPC_PERF_REPORT_FORMAT: " + format_name + " (expected json or csv)");
+  }
+  Append(path, format, record);
+}
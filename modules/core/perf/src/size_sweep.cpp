@@ -0,0 +1,112 @@
+#include "core/perf/include/size_sweep.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+
+ppc::core::SizeSweep::SizeSweep(TaskFactory factory, InputGenerator generator, SweepAttr attr)
+    : factory_(std::move(factory)), generator_(std::move(generator)), attr_(attr) {
+  if (attr_.growth <= 1.0) {
+    throw std::invalid_argument("Growth of size sweep must be greater than 1");
+  }
+}
+
+std::vector<uint64_t> ppc::core::SizeSweep::Sizes() const {
+  std::vector<uint64_t> sizes;
+  for (uint64_t size = attr_.min_size; size <= attr_.max_size;) {
+    sizes.push_back(size);
+    auto next = static_cast<uint64_t>(std::ceil(static_cast<double>(size) * attr_.growth));
+    size = std::max(next, size + 1);
+  }
+  return GetPerfSizes(sizes);
+}
+
+ppc::core::SweepResults ppc::core::SizeSweep::Run() const {
+  auto perf_attr = std::make_shared<PerfAttr>();
+  perf_attr->num_running = attr_.num_running;
+  perf_attr->num_warmup = attr_.num_warmup;
+  perf_attr->current_timer = [] {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  };
+
+  SweepResults results;
+  for (auto size : Sizes()) {
+    auto input = generator_(size);
+    auto task = factory_(input.task_data);
+    auto perf_results = std::make_shared<PerfResults>();
+    Perf(task).TaskRun(perf_attr, perf_results);
+
+    SweepPoint point{.size = size, .input_size = perf_results->input_size, .time_sec = perf_results->median_sec};
+    // Work estimate of generator takes precedence over one declared by task
+    double flops = input.flops > 0.0 ? input.flops : perf_results->work.flops;
+    double bytes = input.bytes > 0.0 ? input.bytes : perf_results->work.bytes;
+    if (point.time_sec > 0.0) {
+      point.elements_per_sec = static_cast<double>(point.input_size) / point.time_sec;
+      point.gflops = flops / point.time_sec * 1e-9;
+      point.gbytes_per_sec = bytes / point.time_sec * 1e-9;
+    }
+    results.points.push_back(point);
+    if (attr_.max_time_sec > 0.0 && point.time_sec > attr_.max_time_sec) {
+      break;
+    }
+  }
+
+  std::vector<double> sizes;
+  std::vector<double> input_sizes;
+  std::vector<double> times;
+  for (const auto &point : results.points) {
+    sizes.push_back(static_cast<double>(point.size));
+    input_sizes.push_back(static_cast<double>(point.input_size));
+    times.push_back(point.time_sec);
+  }
+  results.size_exponent = FitExponent(sizes, times);
+  results.input_exponent = FitExponent(input_sizes, times);
+  return results;
+}
+
+double ppc::core::SizeSweep::FitExponent(const std::vector<double> &x, const std::vector<double> &y) {
+  std::vector<double> log_x;
+  std::vector<double> log_y;
+  for (size_t i = 0; i < std::min(x.size(), y.size()); i++) {
+    if (x[i] > 0.0 && y[i] > 0.0) {
+      log_x.push_back(std::log(x[i]));
+      log_y.push_back(std::log(y[i]));
+    }
+  }
+  if (log_x.size() < 2) {
+    return 0.0;
+  }
+  auto count = static_cast<double>(log_x.size());
+  double mean_x = std::accumulate(log_x.begin(), log_x.end(), 0.0) / count;
+  double mean_y = std::accumulate(log_y.begin(), log_y.end(), 0.0) / count;
+  double cov = 0.0;
+  double var = 0.0;
+  for (size_t i = 0; i < log_x.size(); i++) {
+    cov += (log_x[i] - mean_x) * (log_y[i] - mean_y);
+    var += (log_x[i] - mean_x) * (log_x[i] - mean_x);
+  }
+  return var > 0.0 ? cov / var : 0.0;
+}
+
+void ppc::core::SizeSweep::Print(const std::string &name, const SweepResults &results) {
+  for (const auto &point : results.points) {
+    std::cout << name << ":sweep" << std::scientific << std::setprecision(4) << " size=" << point.size
+              << " input_size=" << point.input_size << " time=" << point.time_sec
+              << " elements_per_sec=" << point.elements_per_sec << " gflops=" << point.gflops
+              << " gbytes_per_sec=" << point.gbytes_per_sec << '\n';
+  }
+  std::cout << name << ":sweep_fit" << std::fixed << std::setprecision(3) << " size_exponent=" << results.size_exponent
+            << " input_exponent=" << results.input_exponent << '\n';
+}
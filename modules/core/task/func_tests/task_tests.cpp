@@ -2,7 +2,10 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <limits>
 #include <memory>
+#include <stdexcept>
 #include <vector>
 
 #include "core/task/func_tests/test_task.hpp"
@@ -178,6 +181,226 @@ TEST(task_tests, check_wrong_order) {
   ASSERT_ANY_THROW(test_task.PostProcessing());
 }
 
+TEST(task_tests, check_typed_views) {
+  // Create data
+  std::vector<double> in(20, 1.5);
+  std::vector<int32_t> out(4, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Views don't copy caller's memory
+  auto input = task_data->Input<const double>(0);
+  EXPECT_EQ(input.data(), in.data());
+  EXPECT_EQ(input.size(), in.size());
+  EXPECT_EQ(task_data->Input<const double>(0, 5).size(), 5U);
+  // Explicit count is checked against stored one, shape-only counts go through unchecked views
+  EXPECT_THROW((void)task_data->Input<const double>(0, 21), std::out_of_range);
+  EXPECT_THROW((void)task_data->Output<int32_t>(0, 5), std::out_of_range);
+  EXPECT_EQ(task_data->UncheckedInput<const uint8_t>(0, 160).size(), 160U);
+
+  auto output = task_data->Output<int32_t>(0);
+  ASSERT_EQ(output.size(), out.size());
+  output[3] = 7;
+  EXPECT_EQ(out[3], 7);
+
+  EXPECT_THROW((void)task_data->Input<double>(1), std::out_of_range);
+  EXPECT_THROW((void)task_data->Output<int32_t>(1, 1), std::out_of_range);
+
+  task_data->inputs.emplace_back(nullptr);
+  task_data->inputs_count.emplace_back(3);
+  EXPECT_THROW((void)task_data->Input<double>(1), std::invalid_argument);
+  EXPECT_TRUE(task_data->Input<double>(1, 0).empty());
+}
+
+TEST(task_tests, check_64bit_counts) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  const uint64_t big_count = (uint64_t{1} << 32) + 5;
+  task_data->inputs.emplace_back(nullptr);
+  task_data->inputs_count.emplace_back(big_count);
+  task_data->outputs.emplace_back(nullptr);
+  task_data->outputs_count.emplace_back(7);
+
+  EXPECT_EQ(task_data->inputs_count[0], big_count);
+  EXPECT_EQ(task_data->InputBytes<double>(0), big_count * sizeof(double));
+  EXPECT_EQ(task_data->OutputBytes<uint16_t>(0), 14U);
+  EXPECT_EQ(task_data->OutputCount32(0), 7U);
+  EXPECT_THROW((void)task_data->InputCount32(0), std::overflow_error);
+}
+
+TEST(task_tests, check_checked_mul) {
+  EXPECT_EQ(ppc::core::CheckedMul(7), 7U);
+  EXPECT_EQ(ppc::core::CheckedMul(100000, 100000, 3), 30000000000U);
+  EXPECT_EQ(ppc::core::CheckedMul(0, std::numeric_limits<uint64_t>::max(), 2), 0U);
+  EXPECT_EQ(ppc::core::ByteSize<uint32_t>(3), 12U);
+  EXPECT_THROW((void)ppc::core::CheckedMul(uint64_t{1} << 40, uint64_t{1} << 30), std::overflow_error);
+  EXPECT_THROW((void)ppc::core::ByteSize<double>(std::numeric_limits<uint64_t>::max() / 4), std::overflow_error);
+}
+
+TEST(task_tests, check_phase_timings) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  const auto &timings = test_task.GetPhaseTimings();
+  EXPECT_EQ(timings.validation.calls, 1U);
+  EXPECT_EQ(timings.pre_processing.calls, 1U);
+  EXPECT_EQ(timings.run.calls, 2U);
+  EXPECT_EQ(timings.post_processing.calls, 1U);
+  EXPECT_GE(timings.run.total_sec, timings.run.last_sec);
+  EXPECT_DOUBLE_EQ(timings.run.MeanSec(), timings.run.total_sec / 2.0);
+
+  test_task.ResetPhaseTimings();
+  EXPECT_EQ(test_task.GetPhaseTimings().run.calls, 0U);
+  EXPECT_DOUBLE_EQ(test_task.GetPhaseTimings().run.MeanSec(), 0.0);
+}
+
+TEST(task_tests, check_reset_restarts_pipeline) {
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  ppc::test::task::ReusableTestTask<int32_t> test_task(task_data);
+  ASSERT_TRUE(test_task.Validation());
+  ASSERT_TRUE(test_task.PreProcessing());
+  // Interrupted pipeline starts from Validation again after reset
+  test_task.Reset();
+  ASSERT_ANY_THROW(test_task.Run());
+  test_task.Reset();
+  ASSERT_TRUE(test_task.Validation());
+  ASSERT_TRUE(test_task.PreProcessing());
+  ASSERT_TRUE(test_task.Run());
+  ASSERT_TRUE(test_task.PostProcessing());
+  EXPECT_EQ(out[0], 20);
+  EXPECT_EQ(test_task.ResetCount(), 2);
+}
+
+TEST(task_tests, check_rebind_reuses_buffers) {
+  std::vector<int32_t> in(100, 1);
+  std::vector<int32_t> out(1, 0);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  ppc::test::task::ReusableTestTask<int32_t> test_task(task_data);
+  ASSERT_TRUE(test_task.Validation());
+  ASSERT_TRUE(test_task.PreProcessing());
+  ASSERT_TRUE(test_task.Run());
+  ASSERT_TRUE(test_task.PostProcessing());
+  ASSERT_EQ(out[0], 100);
+  const int32_t *buffer = test_task.InputBuffer();
+
+  // Same-shaped and smaller requests are processed without reallocation of task's buffers
+  for (size_t size : {100U, 50U}) {
+    std::vector<int32_t> next_in(size, 2);
+    std::vector<int32_t> next_out(1, 0);
+    auto next_data = std::make_shared<ppc::core::TaskData>();
+    next_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(next_in.data()));
+    next_data->inputs_count.emplace_back(next_in.size());
+    next_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(next_out.data()));
+    next_data->outputs_count.emplace_back(next_out.size());
+
+    test_task.Rebind(next_data);
+    EXPECT_EQ(test_task.GetData(), next_data);
+    ASSERT_TRUE(test_task.Validation());
+    ASSERT_TRUE(test_task.PreProcessing());
+    ASSERT_TRUE(test_task.Run());
+    ASSERT_TRUE(test_task.PostProcessing());
+    EXPECT_EQ(next_out[0], static_cast<int32_t>(2 * size));
+    EXPECT_EQ(test_task.InputBuffer(), buffer);
+  }
+  EXPECT_EQ(out[0], 100);
+}
+
+TEST(task_tests, check_copy_output_doesnt_overflow_caller_buffer) {
+  std::vector<int32_t> in(10, 1);
+  std::vector<int32_t> out(1, 0);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  ppc::test::task::ReusableTestTask<int32_t> test_task(task_data);
+  ASSERT_TRUE(test_task.Validation());
+  ASSERT_TRUE(test_task.PreProcessing());
+  ASSERT_TRUE(test_task.Run());
+  // Caller's buffer shrinks after validation, so task's one-element output no longer fits
+  task_data->outputs_count[0] = 0;
+  EXPECT_THROW(test_task.PostProcessing(), std::out_of_range);
+  EXPECT_EQ(out[0], 0);
+}
+
+TEST(task_tests, check_configurable_time_limit) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create TaskData
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Any run exceeds zero limit
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  test_task.SetTimeLimit(0.0, true);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  EXPECT_NO_THROW(test_task.PostProcessing());
+  EXPECT_TRUE(test_task.IsTimeLimitExceeded());
+
+  test_task.SetTimeLimit(0.0);
+  test_task.Reset();
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  EXPECT_ANY_THROW(test_task.PostProcessing());
+
+  test_task.SetTimeLimit(60.0);
+  test_task.Reset();
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  EXPECT_NO_THROW(test_task.PostProcessing());
+  EXPECT_FALSE(test_task.IsTimeLimitExceeded());
+  EXPECT_EQ(static_cast<size_t>(out[0]), in.size());
+
+#ifndef _WIN32
+  setenv("PPC_FUNC_MAX_TIME", "5.5", 1);  // NOLINT(misc-include-cleaner)
+  ppc::test::task::TestTask<int32_t> env_task(task_data);
+  unsetenv("PPC_FUNC_MAX_TIME");  // NOLINT(misc-include-cleaner)
+  EXPECT_DOUBLE_EQ(env_task.GetMaxTestTime(), 5.5);
+#endif
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
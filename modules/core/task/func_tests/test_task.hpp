@@ -46,4 +46,40 @@ class FakeSlowTask : public TestTask<T> {
   }
 };
 
+// Keeps copy of input between runs to check that buffers are reused after Reset/Rebind
+template <class T>
+class ReusableTestTask : public ppc::core::Task {
+ public:
+  explicit ReusableTestTask(const ppc::core::TaskDataPtr &task_data) : Task(task_data) {}
+  bool ValidationImpl() override { return task_data->outputs_count[0] == 1; }
+
+  bool PreProcessingImpl() override {
+    CopyInput(input_, 0);
+    ResetBuffer(output_, 1);
+    return true;
+  }
+
+  bool RunImpl() override {
+    for (const T &value : input_) {
+      output_[0] += value;
+    }
+    return true;
+  }
+
+  bool PostProcessingImpl() override {
+    CopyOutput(output_, 0);
+    return true;
+  }
+
+  [[nodiscard]] const T *InputBuffer() const { return input_.data(); }
+  [[nodiscard]] int ResetCount() const { return reset_count_; }
+
+ protected:
+  void ResetImpl() override { reset_count_++; }
+
+ private:
+  std::vector<T> input_, output_;
+  int reset_count_ = 0;
+};
+
 }  // namespace ppc::test::task
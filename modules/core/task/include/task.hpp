@@ -1,32 +1,185 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <initializer_list>
+#include <limits>
 #include <memory>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 namespace ppc::core {
 
+// Product of counts with overflow check, e.g. CheckedMul(width, height, 3) for size of RGB image
+template <class... Counts>
+std::uint64_t CheckedMul(std::uint64_t first, Counts... counts) {
+  std::uint64_t result = first;
+  for (std::uint64_t count : std::initializer_list<std::uint64_t>{static_cast<std::uint64_t>(counts)...}) {
+    if (count != 0 && result > std::numeric_limits<std::uint64_t>::max() / count) {
+      throw std::overflow_error("Count of elements overflows 64-bit integer");
+    }
+    result *= count;
+  }
+  return result;
+}
+
+// Size in bytes of count elements of T with overflow check
+template <class T>
+std::uint64_t ByteSize(std::uint64_t count) {
+  return CheckedMul(count, sizeof(T));
+}
+
 struct TaskData {
+  // counts are 64-bit to allow buffers larger than 4G elements
+  using CountType = std::uint64_t;
+
   std::vector<uint8_t *> inputs;
-  std::vector<std::uint32_t> inputs_count;
+  std::vector<CountType> inputs_count;
   std::vector<uint8_t *> outputs;
-  std::vector<std::uint32_t> outputs_count;
+  std::vector<CountType> outputs_count;
   enum StateOfTesting : uint8_t { kFunc, kPerf } state_of_testing;
+
+  // Size in bytes of input/output buffer, which contains inputs_count[i]/outputs_count[i] elements of T
+  template <class T>
+  [[nodiscard]] std::uint64_t InputBytes(size_t i) const {
+    return ByteSize<T>(inputs_count.at(i));
+  }
+  template <class T>
+  [[nodiscard]] std::uint64_t OutputBytes(size_t i) const {
+    return ByteSize<T>(outputs_count.at(i));
+  }
+
+  // Compatibility path for code which keeps counts in 32-bit variables (or passes them to int-based APIs like MPI)
+  [[nodiscard]] std::uint32_t InputCount32(size_t i) const { return Narrow32(inputs_count.at(i)); }
+  [[nodiscard]] std::uint32_t OutputCount32(size_t i) const { return Narrow32(outputs_count.at(i)); }
+
+  // Typed view over caller's memory without copying, inputs_count[i] is treated as count of elements of T
+  template <class T>
+  [[nodiscard]] std::span<T> Input(size_t i) const {
+    return MakeView<T>(inputs, inputs_count, i, "input");
+  }
+  // View of first count elements, throws std::out_of_range if count exceeds inputs_count[i]
+  template <class T>
+  [[nodiscard]] std::span<T> Input(size_t i, size_t count) const {
+    return MakePrefixView<T>(inputs, inputs_count, i, count, "input");
+  }
+  template <class T>
+  [[nodiscard]] std::span<T> Output(size_t i) const {
+    return MakeView<T>(outputs, outputs_count, i, "output");
+  }
+  template <class T>
+  [[nodiscard]] std::span<T> Output(size_t i, size_t count) const {
+    return MakePrefixView<T>(outputs, outputs_count, i, count, "output");
+  }
+
+  // Views for buffers whose counts describe shape instead of elements (e.g. width and height of image). count isn't
+  // compared with stored counts, caller guarantees that buffer holds count elements of T
+  template <class T>
+  [[nodiscard]] std::span<T> UncheckedInput(size_t i, size_t count) const {
+    return MakeView<T>(inputs, i, count, "input");
+  }
+  template <class T>
+  [[nodiscard]] std::span<T> UncheckedOutput(size_t i, size_t count) const {
+    return MakeView<T>(outputs, i, count, "output");
+  }
+
+ private:
+  static std::uint32_t Narrow32(CountType count) {
+    if (count > std::numeric_limits<std::uint32_t>::max()) {
+      throw std::overflow_error("Count " + std::to_string(count) + " doesn't fit into 32-bit integer");
+    }
+    return static_cast<std::uint32_t>(count);
+  }
+
+  template <class T>
+  static std::span<T> MakeView(const std::vector<uint8_t *> &buffers, const std::vector<CountType> &counts,
+                               size_t i, const char *kind) {
+    if (i >= counts.size()) {
+      throw std::out_of_range(std::string("TaskData has no count for ") + kind + " #" + std::to_string(i));
+    }
+    return MakeView<T>(buffers, i, counts[i], kind);
+  }
+
+  template <class T>
+  static std::span<T> MakePrefixView(const std::vector<uint8_t *> &buffers, const std::vector<CountType> &counts,
+                                     size_t i, CountType count, const char *kind) {
+    if (i >= counts.size()) {
+      throw std::out_of_range(std::string("TaskData has no count for ") + kind + " #" + std::to_string(i));
+    }
+    if (count > counts[i]) {
+      throw std::out_of_range(std::string("TaskData ") + kind + " #" + std::to_string(i) + " has " +
+                              std::to_string(counts[i]) + " elements, " + std::to_string(count) + " requested");
+    }
+    return MakeView<T>(buffers, i, count, kind);
+  }
+
+  template <class T>
+  static std::span<T> MakeView(const std::vector<uint8_t *> &buffers, size_t i, CountType count, const char *kind) {
+    if (count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+      throw std::overflow_error(std::string("TaskData ") + kind + " #" + std::to_string(i) + " is too large");
+    }
+    if (i >= buffers.size()) {
+      throw std::out_of_range(std::string("TaskData has no ") + kind + " #" + std::to_string(i));
+    }
+    if (buffers[i] == nullptr && count != 0) {
+      throw std::invalid_argument(std::string("TaskData ") + kind + " #" + std::to_string(i) + " is null");
+    }
+    return {reinterpret_cast<T *>(buffers[i]), static_cast<size_t>(count)};
+  }
 };
 
 using TaskDataPtr = std::shared_ptr<ppc::core::TaskData>;
 
+// Durations of one phase of task's pipeline (in seconds)
+struct PhaseTiming {
+  double last_sec = 0.0;
+  double total_sec = 0.0;
+  uint64_t calls = 0;
+  [[nodiscard]] double MeanSec() const { return calls > 0 ? total_sec / static_cast<double>(calls) : 0.0; }
+};
+
+struct PhaseTimings {
+  PhaseTiming validation;
+  PhaseTiming pre_processing;
+  PhaseTiming run;
+  PhaseTiming post_processing;
+};
+
+// Work of one Run() for throughput reporting: floating-point operations (or element operations for non-numeric
+// kernels like sorts) and bytes moved between memory and cores, zero if unknown
+struct WorkEstimate {
+  double flops = 0.0;
+  double bytes = 0.0;
+};
+
 // Memory of inputs and outputs need to be initialized before create object of
 // Task class
 class Task {
  public:
+  static constexpr double kDefaultMaxTestTime = 1.0;
+
   explicit Task(TaskDataPtr task_data);
 
   // set input and output data
   void SetData(TaskDataPtr task_data);
 
+  // prepare task for new pipeline run (Validation, PreProcessing, ...), buffers of task keep their capacity
+  void Reset();
+
+  // reset task and switch it to other data, e.g. next same-shaped request in long-lived service
+  void Rebind(TaskDataPtr task_data);
+
+  // limit of PreProcessing..PostProcessing time in functional tests (in seconds), taken from PPC_FUNC_MAX_TIME
+  // (1 second if it is not set). If record_only is set, exceeded limit is reported instead of throwing
+  void SetTimeLimit(double max_test_time, bool record_only = false);
+  [[nodiscard]] double GetMaxTestTime() const { return max_test_time_; }
+  // true if last functional run exceeded the limit in record-only mode
+  [[nodiscard]] bool IsTimeLimitExceeded() const { return time_limit_exceeded_; }
+
   // validation of data and validation of task attributes before running
   virtual bool Validation();
 
@@ -42,6 +195,13 @@ class Task {
   // get input and output data
   [[nodiscard]] TaskDataPtr GetData() const;
 
+  // get durations of Validation/PreProcessing/Run/PostProcessing accumulated since last reset
+  [[nodiscard]] const PhaseTimings &GetPhaseTimings() const;
+  void ResetPhaseTimings();
+
+  // declared work of Run() for current data, Perf reports GFLOP/s and GB/s from it
+  [[nodiscard]] virtual WorkEstimate EstimateWork() const { return {}; }
+
   virtual ~Task();
 
  protected:
@@ -60,11 +220,46 @@ class Task {
   // implementation of "post_processing" function
   virtual bool PostProcessingImpl() = 0;
 
+  // implementation of "reset" function: drops state of previous run, must not release capacity of buffers
+  virtual void ResetImpl() {}
+
+  // Helpers for buffers which are reused between runs: memory is allocated only when shape grows
+  template <class T>
+  void CopyInput(std::vector<T> &dst, size_t i) const {
+    auto src = task_data->Input<const T>(i);
+    dst.assign(src.begin(), src.end());
+  }
+  template <class T>
+  void CopyInput(std::vector<T> &dst, size_t i, size_t count) const {
+    auto src = task_data->Input<const T>(i, count);
+    dst.assign(src.begin(), src.end());
+  }
+  // Throws std::out_of_range if src doesn't fit into outputs_count[i] elements of caller's buffer
+  template <class T>
+  void CopyOutput(const std::vector<T> &src, size_t i) const {
+    auto dst = task_data->Output<T>(i);
+    if (src.size() > dst.size()) {
+      throw std::out_of_range("Output #" + std::to_string(i) + " has " + std::to_string(dst.size()) +
+                              " elements, task produced " + std::to_string(src.size()));
+    }
+    std::ranges::copy(src, dst.begin());
+  }
+  template <class T>
+  static void ResetBuffer(std::vector<T> &buffer, size_t count, const T &value = T{}) {
+    buffer.assign(count, value);
+  }
+
  private:
-  std::vector<std::string> functions_order_;
-  std::vector<std::string> right_functions_order_ = {"Validation", "PreProcessing", "Run", "PostProcessing"};
-  const double max_test_time_ = 1.0;
+  // number of pipeline functions called in right order since last reset
+  size_t functions_count_ = 0;
+  const std::vector<std::string> right_functions_order_ = {"Validation", "PreProcessing", "Run", "PostProcessing"};
+  double max_test_time_ = kDefaultMaxTestTime;
+  bool record_time_limit_ = false;
+  bool time_limit_exceeded_ = false;
   std::chrono::high_resolution_clock::time_point tmp_time_point_;
+  PhaseTimings phase_timings_;
+
+  bool TimedPhase(PhaseTiming &timing, bool (Task::*impl)());
 };
 
 }  // namespace ppc::core
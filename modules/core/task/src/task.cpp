@@ -1,5 +1,6 @@
 #include "core/task/include/task.hpp"
 
+#include <chrono>
 #include <cstddef>
 #include <iomanip>
 #include <iostream>
@@ -7,50 +8,89 @@
 #include <stdexcept>
 #include <string>
 
+#include "core/util/include/util.hpp"
+
 void ppc::core::Task::SetData(TaskDataPtr task_data_ptr) {
   task_data_ptr->state_of_testing = TaskData::StateOfTesting::kFunc;
-  functions_order_.clear();
+  functions_count_ = 0;
+  ResetPhaseTimings();
+  this->task_data = std::move(task_data_ptr);
+}
+
+void ppc::core::Task::Reset() {
+  functions_count_ = 0;
+  ResetImpl();
+}
+
+void ppc::core::Task::Rebind(TaskDataPtr task_data_ptr) {
+  // new data is tested in the same mode as previous one
+  task_data_ptr->state_of_testing = task_data->state_of_testing;
   this->task_data = std::move(task_data_ptr);
+  Reset();
 }
 
 ppc::core::TaskDataPtr ppc::core::Task::GetData() const { return task_data; }
 
-ppc::core::Task::Task(TaskDataPtr task_data) { SetData(std::move(task_data)); }
+const ppc::core::PhaseTimings& ppc::core::Task::GetPhaseTimings() const { return phase_timings_; }
+
+void ppc::core::Task::ResetPhaseTimings() { phase_timings_ = PhaseTimings{}; }
+
+bool ppc::core::Task::TimedPhase(PhaseTiming& timing, bool (Task::*impl)()) {
+  auto begin = std::chrono::high_resolution_clock::now();
+  bool result = (this->*impl)();
+  auto end = std::chrono::high_resolution_clock::now();
+  auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+  timing.last_sec = static_cast<double>(duration) * 1e-9;
+  timing.total_sec += timing.last_sec;
+  timing.calls++;
+  return result;
+}
+
+ppc::core::Task::Task(TaskDataPtr task_data)
+    : max_test_time_(ppc::util::GetEnvDouble("PPC_FUNC_MAX_TIME", kDefaultMaxTestTime)),
+      record_time_limit_(ppc::util::IsTimeLimitRecorded()) {
+  SetData(std::move(task_data));
+}
+
+void ppc::core::Task::SetTimeLimit(double max_test_time, bool record_only) {
+  max_test_time_ = max_test_time;
+  record_time_limit_ = record_only;
+}
 
 bool ppc::core::Task::Validation() {
   InternalOrderTest();
-  return ValidationImpl();
+  return TimedPhase(phase_timings_.validation, &Task::ValidationImpl);
 }
 
 bool ppc::core::Task::PreProcessing() {
   InternalOrderTest();
-  return PreProcessingImpl();
+  return TimedPhase(phase_timings_.pre_processing, &Task::PreProcessingImpl);
 }
 
 bool ppc::core::Task::Run() {
   InternalOrderTest();
-  return RunImpl();
+  return TimedPhase(phase_timings_.run, &Task::RunImpl);
 }
 
 bool ppc::core::Task::PostProcessing() {
   InternalOrderTest();
-  return PostProcessingImpl();
+  return TimedPhase(phase_timings_.post_processing, &Task::PostProcessingImpl);
 }
 
 void ppc::core::Task::InternalOrderTest(const std::string& str) {
-  if (!functions_order_.empty() && str == functions_order_.back() && str == "Run") {
+  size_t num_functions = right_functions_order_.size();
+  if (functions_count_ > 0 && str == "Run" && right_functions_order_[(functions_count_ - 1) % num_functions] == str) {
     return;
   }
 
-  functions_order_.push_back(str);
-
-  for (size_t i = 0; i < functions_order_.size(); i++) {
-    if (functions_order_[i] != right_functions_order_[i % right_functions_order_.size()]) {
-      throw std::invalid_argument("ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
-                                  std::to_string(i + 1) + "\n" + std::string("Yours function: ") + functions_order_[i] +
-                                  "\n" + std::string("Expected function: ") + right_functions_order_[i]);
-    }
+  // only the position in the cycle is kept, so repeated runs don't grow any history
+  const std::string &expected = right_functions_order_[functions_count_ % num_functions];
+  if (str != expected) {
+    throw std::invalid_argument("ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
+                                std::to_string(functions_count_ + 1) + "\n" + std::string("Yours function: ") + str +
+                                "\n" + std::string("Expected function: ") + expected);
   }
+  functions_count_++;
 
   if (str == "PreProcessing" && task_data->state_of_testing == TaskData::StateOfTesting::kFunc) {
     tmp_time_point_ = std::chrono::high_resolution_clock::now();
@@ -60,8 +100,12 @@ void ppc::core::Task::InternalOrderTest(const std::string& str) {
     auto end = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - tmp_time_point_).count();
     auto current_time = static_cast<double>(duration) * 1e-9;
-    if (current_time < max_test_time_) {
+    time_limit_exceeded_ = current_time >= max_test_time_;
+    if (!time_limit_exceeded_) {
       std::cout << "Test time:" << std::fixed << std::setprecision(10) << current_time;
+    } else if (record_time_limit_) {
+      std::cout << "Test time:" << std::fixed << std::setprecision(10) << current_time
+                << " (exceeds limit of " << max_test_time_ << " secs)\n";
     } else {
       std::stringstream err_msg;
       err_msg << "\nTask execute time need to be: ";
@@ -72,4 +116,4 @@ void ppc::core::Task::InternalOrderTest(const std::string& str) {
   }
 }
 
-ppc::core::Task::~Task() { functions_order_.clear(); }
+ppc::core::Task::~Task() = default;
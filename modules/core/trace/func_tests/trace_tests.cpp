@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/trace/include/trace.hpp"
+
+namespace {
+
+void TracedWork(int depth) {
+  PPC_TRACE_SCOPE("traced_work");
+  if (depth > 0) {
+    TracedWork(depth - 1);
+  }
+}
+
+std::size_t CountEvents(const std::vector<ppc::trace::Event> &events, const std::string &name) {
+  std::size_t count = 0;
+  for (const auto &event : events) {
+    count += name == event.name ? 1 : 0;
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(trace_tests, check_disabled_scope_records_nothing) {
+  ppc::trace::SetEnabled(false);
+  ppc::trace::Clear();
+  TracedWork(3);
+  EXPECT_TRUE(ppc::trace::Collect().empty());
+}
+
+TEST(trace_tests, check_nested_scopes) {
+  ppc::trace::SetEnabled(true);
+  ppc::trace::Clear();
+  TracedWork(2);
+  ppc::trace::SetEnabled(false);
+
+  auto events = ppc::trace::Collect();
+  ASSERT_EQ(events.size(), 3U);
+  // Outer scope starts first and encloses inner ones
+  for (std::size_t i = 1; i < events.size(); i++) {
+    EXPECT_LE(events[i - 1].start_ns, events[i].start_ns);
+    EXPECT_GE(events[i - 1].start_ns + events[i - 1].duration_ns, events[i].start_ns + events[i].duration_ns);
+  }
+}
+
+TEST(trace_tests, check_per_thread_buffers) {
+  constexpr int kNumThreads = 4;
+  constexpr int kEventsPerThread = 100;
+  ppc::trace::SetEnabled(true);
+  ppc::trace::Clear();
+  std::vector<std::thread> threads;
+  threads.reserve(kNumThreads);
+  for (int i = 0; i < kNumThreads; i++) {
+    threads.emplace_back([] {
+      for (int j = 0; j < kEventsPerThread; j++) {
+        PPC_TRACE_SCOPE("thread_work");
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  ppc::trace::SetEnabled(false);
+
+  auto events = ppc::trace::Collect();
+  EXPECT_EQ(CountEvents(events, "thread_work"), static_cast<std::size_t>(kNumThreads * kEventsPerThread));
+  std::vector<uint32_t> tids;
+  for (const auto &event : events) {
+    if (std::ranges::find(tids, event.thread_index) == tids.end()) {
+      tids.push_back(event.thread_index);
+    }
+  }
+  EXPECT_EQ(tids.size(), static_cast<std::size_t>(kNumThreads));
+}
+
+TEST(trace_tests, check_ring_buffer_overwrites_oldest) {
+  ppc::trace::Clear();
+  uint64_t dropped_before = ppc::trace::DroppedCount();
+  for (std::size_t i = 0; i < ppc::trace::kRingCapacity + 10; i++) {
+    ppc::trace::Record("ring", i, i + 1);
+  }
+  auto events = ppc::trace::Collect();
+  ASSERT_EQ(events.size(), ppc::trace::kRingCapacity);
+  EXPECT_EQ(events.front().start_ns, 10U);
+  EXPECT_EQ(ppc::trace::DroppedCount() - dropped_before, 10U);
+  ppc::trace::Clear();
+}
+
+TEST(trace_tests, check_dump_chrome_trace) {
+  ppc::trace::SetEnabled(true);
+  ppc::trace::Clear();
+  {
+    PPC_TRACE_SCOPE("stage \"one\"");
+  }
+  ppc::trace::SetEnabled(false);
+
+  auto path = std::filesystem::temp_directory_path() / "ppc_trace_test.json";
+  ASSERT_TRUE(ppc::trace::Dump(path.string()));
+  std::ifstream file(path);
+  std::stringstream content;
+  content << file.rdbuf();
+  std::string json = content.str();
+  EXPECT_NE(json.find("\"traceEvents\":["), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"stage \\\"one\\\"\",\"ph\":\"X\""), std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"thread_name\",\"ph\":\"M\""), std::string::npos);
+  std::filesystem::remove(path);
+  ppc::trace::Clear();
+}
+
+TEST(trace_tests, check_dump_to_bad_path) {
+  EXPECT_FALSE(ppc::trace::Dump("/nonexistent_ppc_dir/trace.json"));
+}
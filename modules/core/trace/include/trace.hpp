@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Scoped tracing of hot paths, e.g. stages of RunImpl:
+//
+//   void Stage() {
+//     PPC_TRACE_SCOPE("Stage");
+//     ...
+//   }
+//
+// Tracing is enabled if PPC_TRACE_FILE environment variable is set, events are written to this file
+// in Chrome trace format (chrome://tracing, https://ui.perfetto.dev) at process exit.
+// Name of scope must be a string literal or other string with static storage duration.
+
+namespace ppc::trace {
+
+struct Event {
+  const char *name = nullptr;
+  uint64_t start_ns = 0;
+  uint64_t duration_ns = 0;
+  // Sequential number of thread in trace, not OS thread id
+  uint32_t thread_index = 0;
+};
+
+// Every thread keeps last kRingCapacity events, older events are overwritten
+constexpr std::size_t kRingCapacity = std::size_t{1} << 16;
+
+// Nanoseconds since the first call in the process
+uint64_t NowNs();
+
+bool IsEnabled();
+// Overrides PPC_TRACE_FILE, events are still dumped at exit only if PPC_TRACE_FILE is set
+void SetEnabled(bool enabled);
+
+// Appends event to ring buffer of calling thread, lock-free after the first call in the thread
+void Record(const char *name, uint64_t start_ns, uint64_t end_ns);
+
+// Events of all threads sorted by start time. Should be called when traced threads are idle
+std::vector<Event> Collect();
+// Number of events overwritten in ring buffers
+uint64_t DroppedCount();
+void Clear();
+
+// Writes Chrome trace JSON, returns false if file can't be opened
+bool Dump(const std::string &path);
+
+class Scope {
+ public:
+  explicit Scope(const char *name) : name_(IsEnabled() ? name : nullptr), start_ns_(name_ ? NowNs() : 0) {}
+  Scope(const Scope &) = delete;
+  Scope &operator=(const Scope &) = delete;
+  ~Scope() {
+    if (name_ != nullptr) {
+      Record(name_, start_ns_, NowNs());
+    }
+  }
+
+ private:
+  const char *name_;
+  uint64_t start_ns_;
+};
+
+}  // namespace ppc::trace
+
+#define PPC_TRACE_CONCAT_IMPL(a, b) a##b
+#define PPC_TRACE_CONCAT(a, b) PPC_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef PPC_DISABLE_TRACE
+#define PPC_TRACE_SCOPE(name) static_cast<void>(0)
+#else
+#define PPC_TRACE_SCOPE(name) const ::ppc::trace::Scope PPC_TRACE_CONCAT(ppc_trace_scope_, __LINE__)(name)
+#endif
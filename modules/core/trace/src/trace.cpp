@@ -0,0 +1,195 @@
+#include "core/trace/include/trace.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "core/util/include/util.hpp"
+
+namespace {
+
+struct Slot {
+  const char *name;
+  uint64_t start_ns;
+  uint64_t duration_ns;
+};
+
+// Single producer ring: only the owner thread writes slots and advances head
+struct ThreadBuffer {
+  explicit ThreadBuffer(uint32_t index_param)
+      : index(index_param), slots(std::make_unique<Slot[]>(ppc::trace::kRingCapacity)) {}
+
+  uint32_t index;
+  std::atomic<uint64_t> head{0};
+  std::unique_ptr<Slot[]> slots;
+};
+
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+// Never destroyed: threads and atexit handler may access it during process shutdown
+Registry &GetRegistry() {
+  static auto *registry = new Registry;
+  return *registry;
+}
+
+ThreadBuffer &GetThreadBuffer() {
+  // Buffer outlives its thread so that events of finished threads remain in the trace
+  thread_local ThreadBuffer *buffer = [] {
+    Registry &registry = GetRegistry();
+    std::lock_guard lock(registry.mutex);
+    auto index = static_cast<uint32_t>(registry.buffers.size());
+    registry.buffers.push_back(std::make_unique<ThreadBuffer>(index));
+    return registry.buffers.back().get();
+  }();
+  return *buffer;
+}
+
+std::atomic<int> enabled_state{0};
+std::once_flag env_once;
+
+std::string GetTraceFile() { return ppc::util::GetEnvVariable("PPC_TRACE_FILE"); }
+
+void DumpAtExit() { ppc::trace::Dump(GetTraceFile()); }
+
+void InitFromEnv() {
+  std::call_once(env_once, [] {
+    if (!GetTraceFile().empty()) {
+      enabled_state.store(1, std::memory_order_relaxed);
+      std::atexit(DumpAtExit);
+    }
+  });
+}
+
+int GetPid() {
+#ifdef _WIN32
+  return _getpid();
+#else
+  return static_cast<int>(getpid());
+#endif
+}
+
+void WriteEscaped(std::ofstream &file, const char *str) {
+  for (const char *c = str; *c != '\0'; ++c) {
+    if (*c == '"' || *c == '\\') {
+      file << '\\' << *c;
+    } else if (static_cast<unsigned char>(*c) >= 0x20) {
+      file << *c;
+    }
+  }
+}
+
+}  // namespace
+
+uint64_t ppc::trace::NowNs() {
+  static const auto kEpoch = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::steady_clock::now() - kEpoch;
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+bool ppc::trace::IsEnabled() {
+  InitFromEnv();
+  return enabled_state.load(std::memory_order_relaxed) != 0;
+}
+
+void ppc::trace::SetEnabled(bool enabled) {
+  InitFromEnv();
+  enabled_state.store(enabled ? 1 : 0, std::memory_order_relaxed);
+}
+
+void ppc::trace::Record(const char *name, uint64_t start_ns, uint64_t end_ns) {
+  ThreadBuffer &buffer = GetThreadBuffer();
+  uint64_t head = buffer.head.load(std::memory_order_relaxed);
+  buffer.slots[head % kRingCapacity] = {.name = name, .start_ns = start_ns, .duration_ns = end_ns - start_ns};
+  buffer.head.store(head + 1, std::memory_order_release);
+}
+
+std::vector<ppc::trace::Event> ppc::trace::Collect() {
+  std::vector<Event> events;
+  Registry &registry = GetRegistry();
+  {
+    std::lock_guard lock(registry.mutex);
+    for (const auto &buffer : registry.buffers) {
+      uint64_t head = buffer->head.load(std::memory_order_acquire);
+      uint64_t first = head > kRingCapacity ? head - kRingCapacity : 0;
+      for (uint64_t i = first; i < head; i++) {
+        const Slot &slot = buffer->slots[i % kRingCapacity];
+        events.push_back({.name = slot.name,
+                          .start_ns = slot.start_ns,
+                          .duration_ns = slot.duration_ns,
+                          .thread_index = buffer->index});
+      }
+    }
+  }
+  std::ranges::stable_sort(events, {}, &Event::start_ns);
+  return events;
+}
+
+uint64_t ppc::trace::DroppedCount() {
+  uint64_t dropped = 0;
+  Registry &registry = GetRegistry();
+  std::lock_guard lock(registry.mutex);
+  for (const auto &buffer : registry.buffers) {
+    uint64_t head = buffer->head.load(std::memory_order_acquire);
+    dropped += head > kRingCapacity ? head - kRingCapacity : 0;
+  }
+  return dropped;
+}
+
+void ppc::trace::Clear() {
+  Registry &registry = GetRegistry();
+  std::lock_guard lock(registry.mutex);
+  for (const auto &buffer : registry.buffers) {
+    buffer->head.store(0, std::memory_order_release);
+  }
+}
+
+bool ppc::trace::Dump(const std::string &path) {
+  std::vector<Event> events = Collect();
+  std::ofstream file(path);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  int pid = GetPid();
+  uint32_t num_threads = 0;
+  for (const auto &event : events) {
+    num_threads = std::max(num_threads, event.thread_index + 1);
+  }
+
+  file << std::fixed;
+  file.precision(3);
+  file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  for (uint32_t tid = 0; tid < num_threads; tid++) {
+    file << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << tid
+         << ",\"args\":{\"name\":\"thread " << tid << "\"}}";
+    first = false;
+  }
+  for (const auto &event : events) {
+    file << (first ? "" : ",") << "\n{\"name\":\"";
+    WriteEscaped(file, event.name);
+    file << "\",\"ph\":\"X\",\"pid\":" << pid << ",\"tid\":" << event.thread_index
+         << ",\"ts\":" << static_cast<double>(event.start_ns) / 1e3
+         << ",\"dur\":" << static_cast<double>(event.duration_ns) / 1e3 << "}";
+    first = false;
+  }
+  file << "\n]}\n";
+  return file.good();
+}
@@ -1,9 +1,27 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
+#include <limits>
+#include <new>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "core/util/include/affinity.hpp"
+#include "core/util/include/aligned_allocator.hpp"
+#include "core/util/include/scratch_arena.hpp"
+#include "core/util/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 
 TEST(util_tests, check_unset_env) {
@@ -34,3 +52,210 @@ TEST(util_tests, check_set_env) {
   GTEST_SKIP();
 #endif
 }
+
+TEST(util_tests, check_get_env_variable) {
+#ifndef _WIN32
+  setenv("PPC_UTIL_TEST_VARIABLE", "value", 1);  // NOLINT(misc-include-cleaner)
+  EXPECT_EQ(ppc::util::GetEnvVariable("PPC_UTIL_TEST_VARIABLE"), "value");
+
+  unsetenv("PPC_UTIL_TEST_VARIABLE");  // NOLINT(misc-include-cleaner)
+  EXPECT_EQ(ppc::util::GetEnvVariable("PPC_UTIL_TEST_VARIABLE"), "");
+#else
+  GTEST_SKIP();
+#endif
+}
+
+TEST(util_tests, check_get_env_numbers) {
+  EXPECT_DOUBLE_EQ(ppc::util::GetEnvDouble("PPC_UTIL_TEST_NUMBER", 2.5), 2.5);
+  EXPECT_TRUE(ppc::util::GetEnvList("PPC_UTIL_TEST_NUMBER").empty());
+#ifndef _WIN32
+  setenv("PPC_UTIL_TEST_NUMBER", "30", 1);  // NOLINT(misc-include-cleaner)
+  EXPECT_DOUBLE_EQ(ppc::util::GetEnvDouble("PPC_UTIL_TEST_NUMBER", 2.5), 30.0);
+  EXPECT_EQ(ppc::util::GetEnvList("PPC_UTIL_TEST_NUMBER"), std::vector<uint64_t>{30});
+  setenv("PPC_UTIL_TEST_NUMBER", "1.5s", 1);  // NOLINT(misc-include-cleaner)
+  EXPECT_THROW(ppc::util::GetEnvDouble("PPC_UTIL_TEST_NUMBER", 2.5), std::invalid_argument);
+  EXPECT_THROW(ppc::util::GetEnvList("PPC_UTIL_TEST_NUMBER"), std::invalid_argument);
+  unsetenv("PPC_UTIL_TEST_NUMBER");  // NOLINT(misc-include-cleaner)
+#endif
+}
+
+TEST(util_tests, check_thread_pool_parallel_for) {
+  for (size_t num_threads : {1U, 2U, 4U}) {
+    ppc::util::ThreadPool pool(num_threads);
+    EXPECT_EQ(pool.NumThreads(), num_threads);
+    std::vector<int> visits(1000, 0);
+    // Repeated loops are executed by the same workers
+    for (int run = 0; run < 10; run++) {
+      pool.ParallelFor(0, visits.size(), [&](size_t i) { visits[i]++; });
+    }
+    EXPECT_TRUE(std::ranges::all_of(visits, [](int count) { return count == 10; }));
+  }
+}
+
+TEST(util_tests, check_thread_pool_nested_loops) {
+  ppc::util::ThreadPool pool(3);
+  std::atomic<int> count{0};
+  pool.ParallelFor(0, 8, [&](size_t) { pool.ParallelFor(0, 100, [&](size_t) { count++; }, 10); }, 1);
+  EXPECT_EQ(count.load(), 800);
+}
+
+TEST(util_tests, check_thread_pool_exceptions_and_async) {
+  ppc::util::ThreadPool pool(4);
+  EXPECT_THROW(pool.ParallelFor(0, 100,
+                                [](size_t i) {
+                                  if (i == 42) {
+                                    throw std::runtime_error("error");
+                                  }
+                                }),
+               std::runtime_error);
+  // Pool stays usable after exception
+  auto future = pool.Async([] { return 6 * 7; });
+  EXPECT_EQ(future.get(), 42);
+}
+
+TEST(util_tests, check_global_thread_pool) {
+  auto &pool = ppc::util::ThreadPool::Global();
+  EXPECT_EQ(&pool, &ppc::util::ThreadPool::Global());
+  EXPECT_GE(pool.NumThreads(), 1U);
+  std::atomic<size_t> count{0};
+  pool.ParallelFor(0, 100, [&](size_t) { count++; });
+  EXPECT_EQ(count.load(), 100U);
+}
+
+TEST(util_tests, check_parse_affinity) {
+  EXPECT_EQ(ppc::util::ParseAffinity("").policy, ppc::util::AffinityPolicy::kNone);
+  EXPECT_EQ(ppc::util::ParseAffinity("none").policy, ppc::util::AffinityPolicy::kNone);
+  EXPECT_EQ(ppc::util::ParseAffinity("compact").policy, ppc::util::AffinityPolicy::kCompact);
+  EXPECT_EQ(ppc::util::ParseAffinity("scatter").policy, ppc::util::AffinityPolicy::kScatter);
+
+  auto config = ppc::util::ParseAffinity("0-3,8,10-11");
+  EXPECT_EQ(config.policy, ppc::util::AffinityPolicy::kList);
+  EXPECT_EQ(config.cpus, (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+
+  EXPECT_THROW(ppc::util::ParseAffinity("spread"), std::invalid_argument);
+  EXPECT_THROW(ppc::util::ParseAffinity("3-1"), std::invalid_argument);
+  EXPECT_THROW(ppc::util::ParseAffinity("1,,2"), std::invalid_argument);
+}
+
+TEST(util_tests, check_placement_order) {
+  // Two sockets with two cores and two hyper-threads per core
+  std::vector<ppc::util::CpuInfo> topology;
+  for (int cpu = 0; cpu < 8; cpu++) {
+    topology.push_back({.cpu = cpu, .package = (cpu / 2) % 2, .core = cpu % 2});
+  }
+  // cpu: 0 1 2 3 4 5 6 7, package: 0 0 1 1 0 0 1 1, core: 0 1 0 1 0 1 0 1
+  auto compact = ppc::util::GetPlacementOrder(ppc::util::ParseAffinity("compact"), topology);
+  EXPECT_EQ(compact, (std::vector<int>{0, 4, 1, 5, 2, 6, 3, 7}));
+
+  auto scatter = ppc::util::GetPlacementOrder(ppc::util::ParseAffinity("scatter"), topology);
+  EXPECT_EQ(scatter, (std::vector<int>{0, 2, 1, 3, 4, 6, 5, 7}));
+
+  EXPECT_EQ(ppc::util::GetPlacementOrder(ppc::util::ParseAffinity("5,1"), topology), (std::vector<int>{5, 1}));
+  EXPECT_TRUE(ppc::util::GetPlacementOrder(ppc::util::ParseAffinity("none"), topology).empty());
+}
+
+TEST(util_tests, check_pin_current_thread) {
+#ifdef __linux__
+  auto topology = ppc::util::GetCpuTopology();
+  ASSERT_FALSE(topology.empty());
+  int cpu = topology.back().cpu;
+  // Separate thread keeps affinity of test process unchanged
+  std::thread([cpu] {
+    ASSERT_TRUE(ppc::util::PinCurrentThreadToCpu(cpu));
+    EXPECT_EQ(sched_getcpu(), cpu);
+  }).join();
+  EXPECT_FALSE(ppc::util::PinCurrentThreadToCpu(-1));
+#else
+  GTEST_SKIP();
+#endif
+}
+
+TEST(util_tests, check_first_touch_fill) {
+  auto buffer = ppc::util::MakeFirstTouchBuffer<double>(10007, 1.5);
+  EXPECT_TRUE(std::all_of(buffer.get(), buffer.get() + 10007, [](double value) { return value == 1.5; }));
+
+  std::vector<int> data(513, 0);
+  ppc::util::FirstTouchFill(std::span<int>(data), 7);
+  EXPECT_TRUE(std::ranges::all_of(data, [](int value) { return value == 7; }));
+}
+
+TEST(util_tests, check_aligned_buffer) {
+  ppc::util::Buffer<double> buffer(3, 1.5);
+  for (int i = 0; i < 100; i++) {
+    buffer.push_back(i);
+  }
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data()) % ppc::util::kCacheLineSize, 0U);
+  EXPECT_EQ(buffer.size(), 103U);
+  EXPECT_EQ(buffer[2], 1.5);
+  EXPECT_EQ(buffer[102], 99.0);
+
+  ppc::util::Buffer<double> copy(buffer);
+  EXPECT_TRUE(std::ranges::equal(copy, buffer));
+
+  ppc::util::Buffer<char, 256> small(1);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(small.data()) % 256, 0U);
+}
+
+TEST(util_tests, check_aligned_buffer_large_with_options) {
+  constexpr size_t kCount = (size_t{5} << 20) / sizeof(int);
+  ppc::util::AlignedAllocator<int> allocator({.huge_pages = true, .numa_interleave = true});
+  ppc::util::Buffer<int> buffer(kCount, 7, allocator);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data()) % ppc::util::kCacheLineSize, 0U);
+  EXPECT_TRUE(buffer.get_allocator().Options().huge_pages);
+  EXPECT_TRUE(std::ranges::all_of(buffer, [](int value) { return value == 7; }));
+
+  buffer.resize(2 * kCount, 1);
+  EXPECT_EQ(buffer.back(), 1);
+  ppc::util::Buffer<int> moved(std::move(buffer));
+  EXPECT_EQ(moved.size(), 2 * kCount);
+  buffer = std::move(moved);
+  buffer.clear();
+  buffer.shrink_to_fit();
+  EXPECT_EQ(buffer.capacity(), 0U);
+}
+
+TEST(util_tests, check_aligned_allocator_rebind_and_overflow) {
+  ppc::util::AlignedAllocator<int> allocator({.huge_pages = true});
+  ppc::util::AlignedAllocator<double> rebound(allocator);
+  EXPECT_TRUE(rebound.Options().huge_pages);
+  EXPECT_TRUE(rebound == allocator);
+  EXPECT_FALSE(rebound == ppc::util::AlignedAllocator<double>(ppc::util::MemoryOptions{}));
+  EXPECT_THROW(static_cast<void>(rebound.allocate(std::numeric_limits<size_t>::max())), std::bad_array_new_length);
+}
+
+TEST(util_tests, check_scratch_arena_lifo) {
+  ppc::util::ScratchArena arena(1024);
+  auto first = arena.AllocateZeroed<double>(10);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first.data()) % ppc::util::kCacheLineSize, 0U);
+  EXPECT_TRUE(std::ranges::all_of(first, [](double value) { return value == 0.0; }));
+
+  auto marker = arena.Mark();
+  size_t used = arena.UsedBytes();
+  {
+    ppc::util::ScratchArena::Scope scope(arena);
+    auto second = arena.Allocate<int>(16);
+    auto large = arena.Allocate<double>(1000);
+    EXPECT_NE(static_cast<void *>(second.data()), static_cast<void *>(first.data()));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(large.data()) % ppc::util::kCacheLineSize, 0U);
+    EXPECT_GT(arena.UsedBytes(), used);
+  }
+  EXPECT_EQ(arena.UsedBytes(), used);
+
+  // Released memory and blocks are reused without new allocations
+  size_t capacity = arena.CapacityBytes();
+  auto again = arena.Allocate<int>(16);
+  auto large_again = arena.Allocate<double>(1000);
+  EXPECT_EQ(arena.CapacityBytes(), capacity);
+  EXPECT_EQ(large_again.size(), 1000U);
+  EXPECT_EQ(static_cast<void *>(again.data()), static_cast<void *>(first.data() + 16));
+  arena.Release(marker);
+  EXPECT_EQ(arena.UsedBytes(), used);
+}
+
+TEST(util_tests, check_scratch_arena_thread_local) {
+  auto *main_arena = &ppc::util::ScratchArena::ThreadLocal();
+  ppc::util::ScratchArena *other_arena = nullptr;
+  std::thread([&] { other_arena = &ppc::util::ScratchArena::ThreadLocal(); }).join();
+  EXPECT_EQ(main_arena, &ppc::util::ScratchArena::ThreadLocal());
+  EXPECT_NE(main_arena, other_arena);
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "core/util/include/thread_pool.hpp"
+
+// Thread pinning is configured by PPC_AFFINITY environment variable:
+//   none (or unset) - threads are not pinned
+//   compact         - consecutive threads fill cores of one socket (and hyper-threads of one core) first
+//   scatter         - consecutive threads are spread over sockets and physical cores
+//   0-3,8,10-11     - explicit list of CPUs, thread i is pinned to i-th CPU of the list
+// OpenMP, TBB and ThreadPool threads are pinned by thread index within their team.
+
+namespace ppc::util {
+
+enum class AffinityPolicy : uint8_t { kNone, kCompact, kScatter, kList };
+
+struct AffinityConfig {
+  AffinityPolicy policy = AffinityPolicy::kNone;
+  // CPUs of kList policy in order of threads
+  std::vector<int> cpus;
+};
+
+struct CpuInfo {
+  int cpu = 0;
+  int package = 0;
+  int core = 0;
+};
+
+// Throws std::invalid_argument for malformed value
+AffinityConfig ParseAffinity(const std::string &value);
+AffinityConfig GetAffinityConfig();
+
+// CPUs which process was allowed to run on at start, with socket and core ids (Linux only, empty elsewhere)
+std::vector<CpuInfo> GetCpuTopology();
+
+// CPUs in order in which threads 0, 1, ... are placed, empty if threads aren't pinned
+std::vector<int> GetPlacementOrder(const AffinityConfig &config, const std::vector<CpuInfo> &topology);
+
+// Returns false if pinning isn't supported or CPU isn't available
+bool PinCurrentThreadToCpu(int cpu);
+
+// Pins current thread with given index in its team according to PPC_AFFINITY, returns false if thread isn't pinned.
+// Placement wraps around if there are more threads than CPUs
+bool PinCurrentThread(size_t thread_index);
+
+// Shifts thread indexes of this process, e.g. by rank * threads for several MPI processes on one node
+void SetAffinityThreadOffset(size_t offset);
+
+// Pins threads of OpenMP team, runtime reuses these threads in following parallel regions
+inline void PinOpenMPThreads() {
+#ifdef _OPENMP
+  if (GetAffinityConfig().policy == AffinityPolicy::kNone) {
+    return;
+  }
+#pragma omp parallel
+  PinCurrentThread(static_cast<size_t>(omp_get_thread_num()));
+#endif
+}
+
+// First-touch initialization: pages of buffer are placed on NUMA nodes of threads which write them first.
+// With OpenMP buffer is filled by schedule(static) loop, so pages are local to threads of later schedule(static) loops
+// over the same range. Without OpenMP chunks are claimed by pool workers dynamically, so pages are only spread over
+// nodes of workers and aren't tied to threads of later loops
+template <class T>
+void FirstTouchFill(std::span<T> data, const T &value) {
+#ifdef _OPENMP
+  auto size = static_cast<std::int64_t>(data.size());
+#pragma omp parallel for schedule(static)
+  for (std::int64_t i = 0; i < size; i++) {
+    data[i] = value;
+  }
+#else
+  auto &pool = ThreadPool::Global();
+  size_t grain = (data.size() + pool.NumThreads() - 1) / pool.NumThreads();
+  pool.ParallelForRange(
+      0, data.size(),
+      [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+          data[i] = value;
+        }
+      },
+      grain);
+#endif
+}
+
+// Allocates buffer without touching its memory and initializes it by FirstTouchFill.
+// Unlike std::vector(count, value), pages aren't placed on NUMA node of calling thread
+template <class T>
+std::unique_ptr<T[]> MakeFirstTouchBuffer(size_t count, const T &value = T{}) {
+  auto buffer = std::make_unique_for_overwrite<T[]>(count);
+  FirstTouchFill(std::span<T>(buffer.get(), count), value);
+  return buffer;
+}
+
+}  // namespace ppc::util
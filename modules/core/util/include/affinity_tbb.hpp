@@ -0,0 +1,30 @@
+#pragma once
+
+#include <tbb/task_arena.h>
+#include <tbb/task_scheduler_observer.h>
+
+#include <cstddef>
+
+#include "core/util/include/affinity.hpp"
+
+namespace ppc::util {
+
+// Pins threads entering default TBB arena according to PPC_AFFINITY.
+// Separate header, because core library itself doesn't link TBB
+class TbbAffinityObserver : public tbb::task_scheduler_observer {
+ public:
+  TbbAffinityObserver() {
+    if (GetAffinityConfig().policy != AffinityPolicy::kNone) {
+      observe(true);
+    }
+  }
+  TbbAffinityObserver(const TbbAffinityObserver &) = delete;
+  TbbAffinityObserver &operator=(const TbbAffinityObserver &) = delete;
+  ~TbbAffinityObserver() override { observe(false); }
+
+  void on_scheduler_entry(bool /*is_worker*/) override {
+    PinCurrentThread(static_cast<size_t>(tbb::this_task_arena::current_thread_index()));
+  }
+};
+
+}  // namespace ppc::util
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::util {
+
+constexpr std::size_t kCacheLineSize = 64;
+
+struct MemoryOptions {
+  // Advise kernel to back large buffers with transparent huge pages (fewer TLB misses on big matrices and images)
+  bool huge_pages = false;
+  // Interleave pages of large buffers over all NUMA nodes instead of first-touch placement
+  bool numa_interleave = false;
+};
+
+// Defaults from PPC_HUGE_PAGES=1 and PPC_NUMA_INTERLEAVE=1 environment variables
+MemoryOptions GetDefaultMemoryOptions();
+
+// Memory is aligned at least to alignment. With any option set, large buffers (2 MiB and more) are mapped directly
+// and options are applied to them best-effort (ignored if unsupported). Memory must be freed with the same options
+void *AllocateAligned(std::size_t bytes, std::size_t alignment, const MemoryOptions &options);
+void DeallocateAligned(void *ptr, std::size_t bytes, std::size_t alignment, const MemoryOptions &options) noexcept;
+
+// Drop-in allocator for std::vector, e.g. Buffer<double> instead of std::vector<double>
+template <class T, std::size_t Alignment = kCacheLineSize>
+class AlignedAllocator {
+  static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+ public:
+  using value_type = T;
+  // Allocators with different options use different allocation paths, so memory moves only with allocator
+  using is_always_equal = std::false_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  template <class U>
+  struct rebind {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  AlignedAllocator() : options_(GetDefaultMemoryOptions()) {}
+  explicit AlignedAllocator(MemoryOptions options) : options_(options) {}
+  template <class U>
+  AlignedAllocator(const AlignedAllocator<U, Alignment> &other) noexcept  // NOLINT(google-explicit-constructor)
+      : options_(other.Options()) {}
+
+  [[nodiscard]] T *allocate(std::size_t count) {  // NOLINT(readability-identifier-naming)
+    if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(AllocateAligned(count * sizeof(T), Alignment, options_));
+  }
+
+  void deallocate(T *ptr, std::size_t count) noexcept {  // NOLINT(readability-identifier-naming)
+    DeallocateAligned(ptr, count * sizeof(T), Alignment, options_);
+  }
+
+  [[nodiscard]] const MemoryOptions &Options() const { return options_; }
+
+  template <class U>
+  bool operator==(const AlignedAllocator<U, Alignment> &other) const {
+    return options_.huge_pages == other.Options().huge_pages &&
+           options_.numa_interleave == other.Options().numa_interleave;
+  }
+
+ private:
+  MemoryOptions options_;
+};
+
+template <class T, std::size_t Alignment = kCacheLineSize>
+using Buffer = std::vector<T, AlignedAllocator<T, Alignment>>;
+
+}  // namespace ppc::util
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "core/util/include/aligned_allocator.hpp"
+
+namespace ppc::util {
+
+// Bump allocator for scratch memory of recursive kernels. Memory is taken from large blocks and returned in LIFO
+// order by Release or Scope, blocks are kept for reuse, so after the first run recursion doesn't call malloc.
+// Not thread-safe: every thread uses its own arena from ThreadLocal()
+class ScratchArena {
+ public:
+  static constexpr size_t kDefaultBlockSize = size_t{1} << 20;
+
+  // Position in arena, allocations made after Mark() are released by Release(marker)
+  struct Marker {
+    size_t block = 0;
+    size_t offset = 0;
+  };
+
+  // Releases arena position on destruction
+  class Scope {
+   public:
+    explicit Scope(ScratchArena &arena) : arena_(arena), marker_(arena.Mark()) {}
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+    ~Scope() { arena_.Release(marker_); }
+
+   private:
+    ScratchArena &arena_;
+    Marker marker_;
+  };
+
+  explicit ScratchArena(size_t block_size = kDefaultBlockSize) : block_size_(block_size) {}
+  ScratchArena(const ScratchArena &) = delete;
+  ScratchArena &operator=(const ScratchArena &) = delete;
+  ~ScratchArena();
+
+  // Arena of calling thread, created on first use
+  static ScratchArena &ThreadLocal();
+
+  // Uninitialized array of count elements aligned to cache line
+  template <class T>
+  std::span<T> Allocate(size_t count) {
+    static_assert(std::is_trivially_destructible_v<T>, "Arena doesn't call destructors");
+    static_assert(alignof(T) <= kCacheLineSize);
+    if (count > (std::numeric_limits<size_t>::max() - kCacheLineSize) / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return {static_cast<T *>(AllocateBytes(count * sizeof(T))), count};
+  }
+
+  // Zero-filled array
+  template <class T>
+  std::span<T> AllocateZeroed(size_t count) {
+    auto data = Allocate<T>(count);
+    std::uninitialized_fill(data.begin(), data.end(), T{});
+    return data;
+  }
+
+  [[nodiscard]] Marker Mark() const { return {.block = current_, .offset = offset_}; }
+  void Release(Marker marker);
+
+  [[nodiscard]] size_t UsedBytes() const;
+  [[nodiscard]] size_t CapacityBytes() const;
+
+ private:
+  struct Block {
+    std::byte *data = nullptr;
+    size_t size = 0;
+  };
+
+  void *AllocateBytes(size_t bytes);
+
+  size_t block_size_;
+  std::vector<Block> blocks_;
+  size_t current_ = 0;
+  size_t offset_ = 0;
+};
+
+}  // namespace ppc::util
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ppc::util {
+
+// Pool of persistent worker threads, every worker has own deque of jobs and steals jobs of other workers when idle.
+// Repeated parallel loops reuse warm workers instead of creating and joining std::thread on every call
+class ThreadPool {
+ public:
+  using Job = std::function<void()>;
+
+  // num_threads is count of threads which execute parallel loops including calling thread,
+  // so pool of one thread has no workers and runs everything in calling thread
+  explicit ThreadPool(size_t num_threads);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  // Waits for already submitted jobs
+  ~ThreadPool();
+
+  // Process-wide pool sized from PPC_NUM_THREADS (OMP_NUM_THREADS), created on first use
+  static ThreadPool &Global();
+
+  [[nodiscard]] size_t NumThreads() const { return queues_.size() + 1; }
+
+  // Enqueues job which must not throw, job submitted from worker goes to its own deque.
+  // Without workers job is executed immediately
+  void Submit(Job job);
+
+  template <class F>
+  auto Async(F &&func) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+    using Result = std::invoke_result_t<std::decay_t<F>>;
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(func));
+    auto future = task->get_future();
+    Submit([task] { (*task)(); });
+    return future;
+  }
+
+  // Executes one pending job in calling thread, returns false if there are no jobs
+  bool RunPendingJob();
+
+  // Calls body(chunk_begin, chunk_end) for chunks of [begin, end) in parallel, chunk has at least grain elements.
+  // If grain is zero, range is split into several chunks per thread to balance uneven iterations
+  template <class Body>
+  void ParallelForRange(size_t begin, size_t end, Body &&body, size_t grain = 0) {
+    if (end <= begin) {
+      return;
+    }
+    size_t chunk = ChunkSize(end - begin, grain);
+    size_t num_chunks = ((end - begin) + chunk - 1) / chunk;
+    RunChunks(num_chunks, [&](size_t c) {
+      size_t chunk_begin = begin + (c * chunk);
+      body(chunk_begin, std::min(chunk_begin + chunk, end));
+    });
+  }
+
+  // Calls body(i) for every i in [begin, end) in parallel
+  template <class Body>
+  void ParallelFor(size_t begin, size_t end, Body &&body, size_t grain = 0) {
+    ParallelForRange(
+        begin, end,
+        [&](size_t chunk_begin, size_t chunk_end) {
+          for (size_t i = chunk_begin; i < chunk_end; i++) {
+            body(i);
+          }
+        },
+        grain);
+  }
+
+ private:
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<Job> jobs;
+  };
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
+  std::vector<std::thread> workers_;
+  std::atomic<size_t> next_queue_{0};
+  // count of jobs in all queues
+  std::atomic<size_t> pending_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_ = false;
+
+  [[nodiscard]] size_t ChunkSize(size_t size, size_t grain) const;
+  // Calls chunk_body(c) for c in [0, num_chunks), calling thread takes part and helps with pending jobs while waiting
+  void RunChunks(size_t num_chunks, const std::function<void(size_t)> &chunk_body);
+  bool PopJob(size_t preferred_queue, Job &job);
+  void WorkerLoop(size_t index);
+};
+
+}  // namespace ppc::util
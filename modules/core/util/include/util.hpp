@@ -1,9 +1,20 @@
 #pragma once
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace ppc::util {
 
 std::string GetAbsolutePath(const std::string &relative_path);
+// Returns value of environment variable or empty string if it is not set
+std::string GetEnvVariable(const std::string &name);
+// Numeric environment variables, default value is returned if variable is not set.
+// Throw std::invalid_argument for malformed value
+double GetEnvDouble(const std::string &name, double default_value);
+// Comma-separated list like "1000,10000,100000", empty if variable is not set
+std::vector<std::uint64_t> GetEnvList(const std::string &name);
+// Time limits are recorded instead of failing tests if PPC_TIME_LIMIT_MODE=record
+bool IsTimeLimitRecorded();
 int GetPPCNumThreads();
 
 }  // namespace ppc::util
@@ -0,0 +1,179 @@
+#include "core/util/include/affinity.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "core/util/include/util.hpp"
+
+namespace {
+
+int ParseCpu(const std::string &token, const std::string &value) {
+  if (token.empty() || !std::ranges::all_of(token, [](char c) { return c >= '0' && c <= '9'; })) {
+    throw std::invalid_argument("Malformed PPC_AFFINITY value: " + value);
+  }
+  return std::stoi(token);
+}
+
+int ReadTopologyId(int cpu, const std::string &name, int fallback) {
+  std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/" + name);
+  int id = fallback;
+  if (!(file >> id)) {
+    return fallback;
+  }
+  return id;
+}
+
+std::atomic<size_t> thread_offset{0};
+
+}  // namespace
+
+ppc::util::AffinityConfig ppc::util::ParseAffinity(const std::string &value) {
+  AffinityConfig config;
+  if (value.empty() || value == "none") {
+    return config;
+  }
+  if (value == "compact") {
+    config.policy = AffinityPolicy::kCompact;
+    return config;
+  }
+  if (value == "scatter") {
+    config.policy = AffinityPolicy::kScatter;
+    return config;
+  }
+
+  config.policy = AffinityPolicy::kList;
+  std::stringstream list(value);
+  std::string item;
+  while (std::getline(list, item, ',')) {
+    auto dash = item.find('-');
+    if (dash == std::string::npos) {
+      config.cpus.push_back(ParseCpu(item, value));
+      continue;
+    }
+    int first = ParseCpu(item.substr(0, dash), value);
+    int last = ParseCpu(item.substr(dash + 1), value);
+    if (last < first) {
+      throw std::invalid_argument("Malformed PPC_AFFINITY value: " + value);
+    }
+    for (int cpu = first; cpu <= last; cpu++) {
+      config.cpus.push_back(cpu);
+    }
+  }
+  if (config.cpus.empty()) {
+    throw std::invalid_argument("Malformed PPC_AFFINITY value: " + value);
+  }
+  return config;
+}
+
+ppc::util::AffinityConfig ppc::util::GetAffinityConfig() { return ParseAffinity(GetEnvVariable("PPC_AFFINITY")); }
+
+std::vector<ppc::util::CpuInfo> ppc::util::GetCpuTopology() {
+  // Mask is captured once, because pinned threads see only their own CPU
+  static const std::vector<CpuInfo> kTopology = [] {
+    std::vector<CpuInfo> topology;
+#ifdef __linux__
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+      for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &mask)) {
+          topology.push_back({.cpu = cpu,
+                              .package = ReadTopologyId(cpu, "physical_package_id", 0),
+                              .core = ReadTopologyId(cpu, "core_id", cpu)});
+        }
+      }
+    }
+#endif
+    return topology;
+  }();
+  return kTopology;
+}
+
+std::vector<int> ppc::util::GetPlacementOrder(const AffinityConfig &config, const std::vector<CpuInfo> &topology) {
+  std::vector<int> order;
+  if (config.policy == AffinityPolicy::kNone) {
+    return order;
+  }
+  if (config.policy == AffinityPolicy::kList) {
+    return config.cpus;
+  }
+
+  std::vector<CpuInfo> cpus(topology);
+  std::ranges::sort(cpus, {}, [](const CpuInfo &info) { return std::tie(info.package, info.core, info.cpu); });
+  if (config.policy == AffinityPolicy::kCompact) {
+    for (const auto &info : cpus) {
+      order.push_back(info.cpu);
+    }
+    return order;
+  }
+
+  // Scatter: inside socket distinct physical cores go before their hyper-threads, then sockets are interleaved
+  std::map<int, std::vector<std::tuple<int, int, int>>> packages;
+  std::map<std::pair<int, int>, int> siblings;
+  for (const auto &info : cpus) {
+    int sibling = siblings[{info.package, info.core}]++;
+    packages[info.package].emplace_back(sibling, info.core, info.cpu);
+  }
+  size_t max_size = 0;
+  for (auto &package_cpus : packages | std::views::values) {
+    std::ranges::sort(package_cpus);
+    max_size = std::max(max_size, package_cpus.size());
+  }
+  for (size_t i = 0; i < max_size; i++) {
+    for (const auto &package_cpus : packages | std::views::values) {
+      if (i < package_cpus.size()) {
+        order.push_back(std::get<2>(package_cpus[i]));
+      }
+    }
+  }
+  return order;
+}
+
+bool ppc::util::PinCurrentThreadToCpu(int cpu) {
+#ifdef __linux__
+  if (cpu < 0 || cpu >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  CPU_SET(cpu, &mask);
+  return sched_setaffinity(0, sizeof(mask), &mask) == 0;
+#else
+  static_cast<void>(cpu);
+  return false;
+#endif
+}
+
+bool ppc::util::PinCurrentThread(size_t thread_index) {
+  // Task runners validate PPC_AFFINITY at start, other binaries (core tests, batch runner) get warning once here,
+  // because throwing from worker threads would terminate the process
+  static const std::vector<int> kOrder = [] {
+    try {
+      return GetPlacementOrder(GetAffinityConfig(), GetCpuTopology());
+    } catch (const std::invalid_argument &error) {
+      std::cerr << "Warning! " << error.what() << ", threads are not pinned" << '\n';
+      return std::vector<int>{};
+    }
+  }();
+  if (kOrder.empty()) {
+    return false;
+  }
+  return PinCurrentThreadToCpu(kOrder[(thread_offset.load() + thread_index) % kOrder.size()]);
+}
+
+void ppc::util::SetAffinityThreadOffset(size_t offset) { thread_offset.store(offset); }
@@ -0,0 +1,134 @@
+#include "core/util/include/aligned_allocator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "core/util/include/util.hpp"
+
+namespace {
+
+#ifdef __linux__
+// Allocations of this size and larger are mapped directly when options are set
+constexpr std::size_t kLargeAllocation = std::size_t{2} << 20;
+constexpr std::size_t kHugePageSize = std::size_t{2} << 20;
+
+// Buffers start at different offsets inside their huge-page aligned mappings, otherwise rows of several matrices
+// map to the same cache sets
+constexpr std::size_t kNumColors = 8;
+constexpr std::size_t kColorStep = 4096 + ppc::util::kCacheLineSize;
+constexpr std::size_t kMaxColorAlignment = 4096;
+constexpr std::size_t kColorReserve = kNumColors * 2 * kMaxColorAlignment;
+
+std::atomic<std::size_t> next_color{0};
+
+std::size_t RoundUp(std::size_t value, std::size_t multiple) { return (value + multiple - 1) / multiple * multiple; }
+
+bool IsMapped(std::size_t bytes, std::size_t alignment, const ppc::util::MemoryOptions &options) {
+  return (options.huge_pages || options.numa_interleave) && bytes >= kLargeAllocation &&
+         alignment <= kMaxColorAlignment;
+}
+
+std::size_t MappedSize(std::size_t bytes) { return RoundUp(bytes + kColorReserve, kHugePageSize); }
+
+// MPOL_INTERLEAVE from linux/mempolicy.h, libnuma isn't required
+constexpr int kMpolInterleave = 3;
+
+// Mask of online NUMA nodes from sysfs, e.g. "0-1" or "0,2"
+uint64_t GetOnlineNodesMask() {
+  std::ifstream file("/sys/devices/system/node/online");
+  std::string list;
+  if (!(file >> list)) {
+    return 1;
+  }
+  uint64_t mask = 0;
+  std::stringstream stream(list);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    auto dash = item.find('-');
+    int first = std::stoi(item.substr(0, dash));
+    int last = dash == std::string::npos ? first : std::stoi(item.substr(dash + 1));
+    for (int node = first; node <= std::min(last, 63); node++) {
+      mask |= uint64_t{1} << node;
+    }
+  }
+  return mask;
+}
+
+void *MapLarge(std::size_t bytes, std::size_t alignment, const ppc::util::MemoryOptions &options) {
+  std::size_t size = MappedSize(bytes);
+  // Extra huge page is mapped to cut region aligned to huge page out of it
+  std::size_t mapped_size = size + kHugePageSize;
+  void *mapped = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapped == MAP_FAILED) {
+    throw std::bad_alloc();
+  }
+  auto begin = reinterpret_cast<std::uintptr_t>(mapped);
+  auto aligned = RoundUp(begin, kHugePageSize);
+  if (aligned > begin) {
+    munmap(mapped, aligned - begin);
+  }
+  std::size_t tail = (begin + mapped_size) - (aligned + size);
+  if (tail > 0) {
+    munmap(reinterpret_cast<void *>(aligned + size), tail);
+  }
+
+  auto *region = reinterpret_cast<void *>(aligned);
+  if (options.huge_pages) {
+    madvise(region, size, MADV_HUGEPAGE);
+  }
+  if (options.numa_interleave) {
+    uint64_t nodes = GetOnlineNodesMask();
+    syscall(SYS_mbind, region, size, kMpolInterleave, &nodes, sizeof(nodes) * 8, 0);
+  }
+  std::size_t offset = (next_color.fetch_add(1) % kNumColors) * RoundUp(kColorStep, alignment);
+  return reinterpret_cast<void *>(aligned + offset);
+}
+#endif
+
+}  // namespace
+
+ppc::util::MemoryOptions ppc::util::GetDefaultMemoryOptions() {
+  static const MemoryOptions kOptions{.huge_pages = GetEnvVariable("PPC_HUGE_PAGES") == "1",
+                                      .numa_interleave = GetEnvVariable("PPC_NUMA_INTERLEAVE") == "1"};
+  return kOptions;
+}
+
+void *ppc::util::AllocateAligned(std::size_t bytes, std::size_t alignment, const MemoryOptions &options) {
+#ifdef __linux__
+  if (IsMapped(bytes, alignment, options)) {
+    return MapLarge(bytes, alignment, options);
+  }
+#else
+  static_cast<void>(options);
+#endif
+  return ::operator new(std::max<std::size_t>(bytes, 1), std::align_val_t(alignment));
+}
+
+void ppc::util::DeallocateAligned(void *ptr, std::size_t bytes, std::size_t alignment,
+                                  const MemoryOptions &options) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+#ifdef __linux__
+  if (IsMapped(bytes, alignment, options)) {
+    auto region = reinterpret_cast<std::uintptr_t>(ptr) / kHugePageSize * kHugePageSize;
+    munmap(reinterpret_cast<void *>(region), MappedSize(bytes));
+    return;
+  }
+#else
+  static_cast<void>(options);
+#endif
+  ::operator delete(ptr, std::align_val_t(alignment));
+}
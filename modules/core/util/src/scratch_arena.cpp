@@ -0,0 +1,61 @@
+#include "core/util/include/scratch_arena.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+#include "core/util/include/aligned_allocator.hpp"
+
+ppc::util::ScratchArena::~ScratchArena() {
+  for (const auto &block : blocks_) {
+    DeallocateAligned(block.data, block.size, kCacheLineSize, MemoryOptions{});
+  }
+}
+
+ppc::util::ScratchArena &ppc::util::ScratchArena::ThreadLocal() {
+  thread_local ScratchArena arena;
+  return arena;
+}
+
+void *ppc::util::ScratchArena::AllocateBytes(size_t bytes) {
+  bytes = (bytes + kCacheLineSize - 1) / kCacheLineSize * kCacheLineSize;
+  if (!blocks_.empty() && offset_ + bytes <= blocks_[current_].size) {
+    void *ptr = blocks_[current_].data + offset_;
+    offset_ += bytes;
+    return ptr;
+  }
+
+  // Tail of current block is skipped, following blocks are reused if they are large enough
+  size_t next = blocks_.empty() ? 0 : current_ + 1;
+  while (next < blocks_.size() && blocks_[next].size < bytes) {
+    next++;
+  }
+  if (next == blocks_.size()) {
+    size_t size = std::max({block_size_, bytes, blocks_.empty() ? size_t{0} : blocks_.back().size * 2});
+    blocks_.push_back({.data = static_cast<std::byte *>(AllocateAligned(size, kCacheLineSize, MemoryOptions{})),
+                       .size = size});
+  }
+  current_ = next;
+  offset_ = bytes;
+  return blocks_[current_].data;
+}
+
+void ppc::util::ScratchArena::Release(Marker marker) {
+  current_ = marker.block;
+  offset_ = marker.offset;
+}
+
+size_t ppc::util::ScratchArena::UsedBytes() const {
+  size_t used = offset_;
+  for (size_t i = 0; i < current_ && i < blocks_.size(); i++) {
+    used += blocks_[i].size;
+  }
+  return used;
+}
+
+size_t ppc::util::ScratchArena::CapacityBytes() const {
+  size_t capacity = 0;
+  for (const auto &block : blocks_) {
+    capacity += block.size;
+  }
+  return capacity;
+}
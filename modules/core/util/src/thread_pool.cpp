@@ -0,0 +1,191 @@
+#include "core/util/include/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "core/util/include/affinity.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// Pool and index of queue of current worker thread, used to push nested jobs into own deque
+thread_local const ppc::util::ThreadPool *current_pool = nullptr;
+thread_local size_t current_queue = 0;
+
+}  // namespace
+
+ppc::util::ThreadPool::ThreadPool(size_t num_threads) {
+  size_t num_workers = num_threads > 1 ? num_threads - 1 : 0;
+  queues_.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; i++) {
+    queues_.push_back(std::make_unique<WorkerQueue>());
+  }
+  workers_.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; i++) {
+    workers_.emplace_back([this, i] { WorkerLoop(i); });
+  }
+}
+
+ppc::util::ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard lock(sleep_mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+ppc::util::ThreadPool &ppc::util::ThreadPool::Global() {
+  static ThreadPool pool(static_cast<size_t>(std::max(GetPPCNumThreads(), 1)));
+  return pool;
+}
+
+void ppc::util::ThreadPool::Submit(Job job) {
+  if (queues_.empty()) {
+    job();
+    return;
+  }
+  size_t index = current_pool == this ? current_queue : next_queue_.fetch_add(1) % queues_.size();
+  {
+    std::lock_guard lock(queues_[index]->mutex);
+    queues_[index]->jobs.push_back(std::move(job));
+  }
+  {
+    std::lock_guard lock(sleep_mutex_);
+    pending_.fetch_add(1);
+  }
+  wake_.notify_one();
+}
+
+bool ppc::util::ThreadPool::PopJob(size_t preferred_queue, Job &job) {
+  if (pending_.load() == 0) {
+    return false;
+  }
+  // Own deque is used as stack (recently pushed jobs are hot in cache), other deques are stolen from the front
+  if (current_pool == this) {
+    auto &own = *queues_[preferred_queue];
+    std::lock_guard lock(own.mutex);
+    if (!own.jobs.empty()) {
+      job = std::move(own.jobs.back());
+      own.jobs.pop_back();
+      pending_.fetch_sub(1);
+      return true;
+    }
+  }
+  for (size_t shift = 0; shift < queues_.size(); shift++) {
+    auto &victim = *queues_[(preferred_queue + shift) % queues_.size()];
+    std::lock_guard lock(victim.mutex);
+    if (!victim.jobs.empty()) {
+      job = std::move(victim.jobs.front());
+      victim.jobs.pop_front();
+      pending_.fetch_sub(1);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ppc::util::ThreadPool::RunPendingJob() {
+  Job job;
+  if (!PopJob(current_pool == this ? current_queue : 0, job)) {
+    return false;
+  }
+  job();
+  return true;
+}
+
+void ppc::util::ThreadPool::WorkerLoop(size_t index) {
+  current_pool = this;
+  current_queue = index;
+  // Calling thread of parallel loops has index 0 in the team
+  PinCurrentThread(index + 1);
+  while (true) {
+    Job job;
+    if (PopJob(index, job)) {
+      job();
+      continue;
+    }
+    std::unique_lock lock(sleep_mutex_);
+    wake_.wait(lock, [&] { return stop_ || pending_.load() > 0; });
+    if (stop_ && pending_.load() == 0) {
+      return;
+    }
+  }
+}
+
+size_t ppc::util::ThreadPool::ChunkSize(size_t size, size_t grain) const {
+  if (grain > 0) {
+    return grain;
+  }
+  constexpr size_t kChunksPerThread = 4;
+  size_t num_chunks = NumThreads() > 1 ? NumThreads() * kChunksPerThread : 1;
+  return std::max<size_t>((size + num_chunks - 1) / num_chunks, 1);
+}
+
+void ppc::util::ThreadPool::RunChunks(size_t num_chunks, const std::function<void(size_t)> &chunk_body) {
+  if (queues_.empty() || num_chunks <= 1) {
+    for (size_t c = 0; c < num_chunks; c++) {
+      chunk_body(c);
+    }
+    return;
+  }
+
+  // Chunks are claimed dynamically by helper jobs and calling thread
+  std::atomic<size_t> next_chunk{0};
+  std::atomic<size_t> active_helpers{0};
+  std::mutex done_mutex;
+  std::condition_variable done;
+  std::exception_ptr error;
+
+  auto run_chunks = [&] {
+    for (size_t c = next_chunk.fetch_add(1); c < num_chunks; c = next_chunk.fetch_add(1)) {
+      try {
+        chunk_body(c);
+      } catch (...) {
+        std::lock_guard lock(done_mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+    }
+  };
+
+  size_t num_helpers = std::min(queues_.size(), num_chunks - 1);
+  active_helpers.store(num_helpers);
+  for (size_t i = 0; i < num_helpers; i++) {
+    Submit([&] {
+      run_chunks();
+      std::lock_guard lock(done_mutex);
+      if (active_helpers.fetch_sub(1) == 1) {
+        done.notify_all();
+      }
+    });
+  }
+  run_chunks();
+
+  // Helpers may wait in queues behind busy workers (e.g. in nested loops), so calling thread executes pending jobs
+  while (active_helpers.load() > 0) {
+    if (RunPendingJob()) {
+      continue;
+    }
+    std::unique_lock lock(done_mutex);
+    done.wait_for(lock, std::chrono::microseconds(100), [&] { return active_helpers.load() == 0; });
+  }
+  // Last helper may still hold the mutex after decrement, state on stack must outlive it
+  std::lock_guard lock(done_mutex);
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
@@ -8,25 +8,78 @@
 #include <vector>
 #endif
 
+#include <cstdint>
 #include <filesystem>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 std::string ppc::util::GetAbsolutePath(const std::string &relative_path) {
   const std::filesystem::path path = std::string(PPC_PATH_TO_PROJECT) + "/tasks/" + relative_path;
   return path.string();
 }
 
-int ppc::util::GetPPCNumThreads() {
+std::string ppc::util::GetEnvVariable(const std::string &name) {
 #ifdef _WIN32
   size_t len;
-  char omp_env[100];
-  errno_t err = getenv_s(&len, omp_env, sizeof(omp_env), "OMP_NUM_THREADS");
+  char env[1024];
+  errno_t err = getenv_s(&len, env, sizeof(env), name.c_str());
   if (err != 0 || len == 0) {
-    omp_env[0] = '\0';
+    env[0] = '\0';
   }
+  return std::string(env);
 #else
-  const char *omp_env = std::getenv("OMP_NUM_THREADS");
+  const char *env = std::getenv(name.c_str());
+  return (env != nullptr) ? std::string(env) : std::string();
 #endif
-  int num_threads = (omp_env != nullptr) ? std::atoi(omp_env) : 1;
+}
+
+double ppc::util::GetEnvDouble(const std::string &name, double default_value) {
+  const std::string value = GetEnvVariable(name);
+  if (value.empty()) {
+    return default_value;
+  }
+  size_t parsed = 0;
+  double result = 0.0;
+  try {
+    result = std::stod(value, &parsed);
+  } catch (const std::exception &) {
+    parsed = 0;
+  }
+  if (parsed != value.size()) {
+    throw std::invalid_argument("Malformed " + name + " value: " + value);
+  }
+  return result;
+}
+
+std::vector<std::uint64_t> ppc::util::GetEnvList(const std::string &name) {
+  const std::string value = GetEnvVariable(name);
+  std::vector<std::uint64_t> list;
+  std::stringstream stream(value);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    if (item.empty() || item.find_first_not_of("0123456789") != std::string::npos) {
+      throw std::invalid_argument("Malformed " + name + " value: " + value);
+    }
+    list.push_back(std::stoull(item));
+  }
+  return list;
+}
+
+bool ppc::util::IsTimeLimitRecorded() {
+  const std::string mode = GetEnvVariable("PPC_TIME_LIMIT_MODE");
+  if (mode.empty() || mode == "throw") {
+    return false;
+  }
+  if (mode == "record") {
+    return true;
+  }
+  throw std::invalid_argument("Unknown PPC_TIME_LIMIT_MODE: " + mode + " (expected throw or record)");
+}
+
+int ppc::util::GetPPCNumThreads() {
+  const std::string omp_env = GetEnvVariable("OMP_NUM_THREADS");
+  int num_threads = !omp_env.empty() ? std::atoi(omp_env.c_str()) : 1;
   return num_threads;
 }
@@ -2,24 +2,21 @@
 #define MODULES_REFERENCE_AVERAGE_OF_VECTOR_ELEMENTS_REF_TASK_HPP_
 
 #include <memory>
-#include <numeric>
-#include <vector>
+#include <span>
 
+#include "core/par/include/par.hpp"
 #include "core/task/include/task.hpp"
+#include "ref/reductions/include/reductions.hpp"
 
 namespace ppc::reference {
 
-template <class InType, class OutType>
+template <class InType, class OutType, class Backend = ppc::par::Seq>
 class AverageOfVectorElements : public ppc::core::Task {
  public:
   explicit AverageOfVectorElements(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<InType>(task_data->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InType*>(task_data->inputs[0]);
-    for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Input is read in place
+    input_ = std::span<const InType>(reinterpret_cast<const InType*>(task_data->inputs[0]), task_data->inputs_count[0]);
     // Init value for output
     average_ = 0.0;
     return true;
@@ -31,7 +28,7 @@ class AverageOfVectorElements : public ppc::core::Task {
   }
 
   bool RunImpl() override {
-    average_ = static_cast<OutType>(std::accumulate(input_.begin(), input_.end(), 0.0));
+    average_ = static_cast<OutType>(Sum<double, Backend>(input_));
     average_ /= static_cast<OutType>(task_data->inputs_count[0]);
     return true;
   }
@@ -42,7 +39,7 @@ class AverageOfVectorElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InType> input_;
+  std::span<const InType> input_;
   OutType average_;
 };
 
@@ -1,25 +1,23 @@
 #ifndef MODULES_REFERENCE_MIN_OF_VECTOR_ELEMENTS_REF_TASK_HPP_
 #define MODULES_REFERENCE_MIN_OF_VECTOR_ELEMENTS_REF_TASK_HPP_
 
-#include <algorithm>
 #include <memory>
-#include <vector>
+#include <span>
 
+#include "core/par/include/par.hpp"
 #include "core/task/include/task.hpp"
+#include "ref/reductions/include/reductions.hpp"
 
 namespace ppc::reference {
 
-template <class InOutType, class IndexType>
+template <class InOutType, class IndexType, class Backend = ppc::par::Seq>
 class MinOfVectorElements : public ppc::core::Task {
  public:
   explicit MinOfVectorElements(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<InOutType>(task_data->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(task_data->inputs[0]);
-    for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Input is read in place
+    input_ = std::span<const InOutType>(reinterpret_cast<const InOutType*>(task_data->inputs[0]),
+                                        task_data->inputs_count[0]);
     // Init value for output
     min_ = 0.0;
     min_index_ = 0;
@@ -37,9 +35,9 @@ class MinOfVectorElements : public ppc::core::Task {
   }
 
   bool RunImpl() override {
-    auto result = std::min_element(input_.begin(), input_.end());
-    min_ = static_cast<InOutType>(*result);
-    min_index_ = static_cast<IndexType>(std::distance(input_.begin(), result));
+    auto [value, index] = MinElement<Backend>(input_);
+    min_ = value;
+    min_index_ = static_cast<IndexType>(index);
     return true;
   }
 
@@ -50,7 +48,7 @@ class MinOfVectorElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  std::span<const InOutType> input_;
   InOutType min_;
   IndexType min_index_;
 };
@@ -1,26 +1,23 @@
 #ifndef MODULES_REFERENCE_NUM_OF_ALTERNATIONS_SIGNS_REF_TASK_HPP_
 #define MODULES_REFERENCE_NUM_OF_ALTERNATIONS_SIGNS_REF_TASK_HPP_
 
-#include <algorithm>
-#include <functional>
 #include <memory>
-#include <vector>
+#include <span>
 
+#include "core/par/include/par.hpp"
 #include "core/task/include/task.hpp"
+#include "ref/reductions/include/reductions.hpp"
 
 namespace ppc::reference {
 
-template <class InOutType, class CountType>
+template <class InOutType, class CountType, class Backend = ppc::par::Seq>
 class NumOfAlternationsSigns : public ppc::core::Task {
  public:
   explicit NumOfAlternationsSigns(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<InOutType>(task_data->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(task_data->inputs[0]);
-    for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Input is read in place
+    input_ = std::span<const InOutType>(reinterpret_cast<const InOutType*>(task_data->inputs[0]),
+                                        task_data->inputs_count[0]);
     // Init value for output
     num_ = 0;
     return true;
@@ -32,14 +29,7 @@ class NumOfAlternationsSigns : public ppc::core::Task {
   }
 
   bool RunImpl() override {
-    auto rotate_in = input_;
-    int rot_left = 1;
-    rotate(rotate_in.begin(), rotate_in.begin() + rot_left, rotate_in.end());
-
-    auto temp_res = input_;
-    std::transform(input_.begin(), input_.end(), rotate_in.begin(), temp_res.begin(), std::multiplies<>());
-
-    num_ = std::count_if(temp_res.begin(), temp_res.end() - 1, [](InOutType elem) { return elem < 0; });
+    num_ = static_cast<CountType>(CountSignAlternations<Backend>(input_));
     return true;
   }
 
@@ -49,7 +39,7 @@ class NumOfAlternationsSigns : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  std::span<const InOutType> input_;
   CountType num_;
 };
 
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "core/par/include/par.hpp"
+#include "ref/reductions/include/reductions.hpp"
+
+namespace {
+
+template <class Backend>
+class ReductionsTest : public ::testing::Test {};
+
+using Backends = ::testing::Types<ppc::par::Seq, ppc::par::Omp, ppc::par::Stl>;
+TYPED_TEST_SUITE(ReductionsTest, Backends);
+
+// Sizes around unrolling and parallel thresholds
+const std::vector<size_t> kSizes{0, 1, 7, 8, 9, 1000, (size_t{1} << 15) + 3, (size_t{1} << 18) + 5};
+
+std::vector<int32_t> MakeSigned(size_t size) {
+  std::vector<int32_t> data(size);
+  for (size_t i = 0; i < size; i++) {
+    data[i] = static_cast<int32_t>((i * 7919) % 2001) - 1000;
+  }
+  return data;
+}
+
+}  // namespace
+
+TYPED_TEST(ReductionsTest, check_sum) {
+  for (auto size : kSizes) {
+    auto data = MakeSigned(size);
+    auto expected = std::accumulate(data.begin(), data.end(), int64_t{0});
+    EXPECT_EQ((ppc::reference::Sum<int64_t, TypeParam>(std::span<const int32_t>(data))), expected) << size;
+  }
+}
+
+TYPED_TEST(ReductionsTest, check_sum_doesnt_truncate_fractions) {
+  std::vector<double> data(100001, 0.25);
+  EXPECT_DOUBLE_EQ((ppc::reference::Sum<double, TypeParam>(std::span<const double>(data))), 25000.25);
+}
+
+TYPED_TEST(ReductionsTest, check_sum_is_deterministic) {
+  std::vector<double> data(300007);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = 1.0 / static_cast<double>(i + 1);
+  }
+  auto first = ppc::reference::Sum<double, TypeParam>(std::span<const double>(data));
+  EXPECT_EQ((ppc::reference::Sum<double, TypeParam>(std::span<const double>(data))), first);
+  EXPECT_NEAR(first, std::accumulate(data.begin(), data.end(), 0.0), 1e-9);
+}
+
+TYPED_TEST(ReductionsTest, check_sum_is_same_for_every_thread_count) {
+  std::vector<double> data(300007);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = (1.0 / static_cast<double>(i + 1)) - 1e-6;
+  }
+  auto expected = ppc::reference::Sum<double>(std::span<const double>(data));
+  EXPECT_EQ((ppc::reference::Sum<double, TypeParam>(std::span<const double>(data))), expected);
+#ifdef _OPENMP
+  int max_threads = omp_get_max_threads();
+  for (int num_threads : {1, 2, 3, 7}) {
+    omp_set_num_threads(num_threads);
+    EXPECT_EQ((ppc::reference::Sum<double, TypeParam>(std::span<const double>(data))), expected) << num_threads;
+  }
+  omp_set_num_threads(max_threads);
+#endif
+}
+
+TYPED_TEST(ReductionsTest, check_dot) {
+  for (auto size : kSizes) {
+    auto lhs = MakeSigned(size);
+    auto rhs = MakeSigned(size);
+    std::ranges::reverse(rhs);
+    auto expected = std::inner_product(lhs.begin(), lhs.end(), rhs.begin(), int64_t{0});
+    EXPECT_EQ((ppc::reference::Dot<int64_t, TypeParam>(std::span<const int32_t>(lhs), std::span<const int32_t>(rhs))),
+              expected)
+        << size;
+  }
+}
+
+TYPED_TEST(ReductionsTest, check_min_max_first_index) {
+  for (auto size : kSizes) {
+    if (size == 0) {
+      continue;
+    }
+    auto data = MakeSigned(size);
+    auto min = std::ranges::min_element(data);
+    auto max = std::ranges::max_element(data);
+    auto [min_value, min_index] = ppc::reference::MinElement<TypeParam>(std::span<const int32_t>(data));
+    EXPECT_EQ(min_value, *min);
+    EXPECT_EQ(min_index, static_cast<size_t>(min - data.begin())) << size;
+    auto [max_value, max_index] = ppc::reference::MaxElement<TypeParam>(std::span<const int32_t>(data));
+    EXPECT_EQ(max_value, *max);
+    EXPECT_EQ(max_index, static_cast<size_t>(max - data.begin())) << size;
+  }
+}
+
+TYPED_TEST(ReductionsTest, check_min_of_empty_input) {
+  std::vector<double> data;
+  auto [value, index] = ppc::reference::MinElement<TypeParam>(std::span<const double>(data));
+  EXPECT_DOUBLE_EQ(value, 0.0);
+  EXPECT_EQ(index, 0U);
+}
+
+TYPED_TEST(ReductionsTest, check_sign_alternations) {
+  for (auto size : kSizes) {
+    auto data = MakeSigned(size);
+    size_t expected = 0;
+    for (size_t i = 0; i + 1 < size; i++) {
+      expected += static_cast<size_t>((data[i] < 0 && data[i + 1] > 0) || (data[i] > 0 && data[i + 1] < 0));
+    }
+    EXPECT_EQ(ppc::reference::CountSignAlternations<TypeParam>(std::span<const int32_t>(data)), expected) << size;
+  }
+}
+
+TEST(reductions, check_sign_alternations_of_large_values) {
+  // Product of neighbours overflows int64_t
+  std::vector<int64_t> data{INT64_MAX, INT64_MIN, INT64_MAX, 0, -1};
+  EXPECT_EQ(ppc::reference::CountSignAlternations(std::span<const int64_t>(data)), 2U);
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "core/par/include/par.hpp"
+
+// Reductions of reference tasks run on ppc::par backend tags (ppc::par::Seq, Omp, Stl or Tbb of par_tbb.hpp)
+namespace ppc::reference {
+
+// Accumulator which doesn't overflow for sums of integers and keeps precision of float sums
+template <class T>
+using WideAccumulator = std::conditional_t<std::is_floating_point_v<T>, double,
+                                           std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>;
+
+namespace detail {
+
+// Independent accumulators break dependency chain of reduction, so loop is vectorized without -ffast-math
+constexpr size_t kNumAccumulators = 8;
+// Grain of ppc::par::Partition: smaller inputs are reduced in calling thread, waking workers costs more than the
+// loop. Chunks depend only on size, so floating point results are the same bits for every backend and thread count
+constexpr size_t kMinParallelSize = size_t{1} << 15;
+
+template <class Acc, class Load>
+Acc SumRange(size_t begin, size_t end, Load &&load) {
+  std::array<Acc, kNumAccumulators> acc{};
+  size_t i = begin;
+  for (; i + kNumAccumulators <= end; i += kNumAccumulators) {
+    for (size_t k = 0; k < kNumAccumulators; k++) {
+      acc[k] += load(i + k);
+    }
+  }
+  for (; i < end; i++) {
+    acc[0] += load(i);
+  }
+  for (size_t width = kNumAccumulators / 2; width > 0; width /= 2) {
+    for (size_t k = 0; k < width; k++) {
+      acc[k] += acc[k + width];
+    }
+  }
+  return acc[0];
+}
+
+template <class Backend, class T, class Map, class Combine>
+T Reduce(size_t size, T identity, Map &&map, Combine &&combine) {
+  return ppc::par::ParallelReduce<Backend>(size_t{0}, size, std::move(identity), map, combine, kMinParallelSize);
+}
+
+// Extremum with index of its first occurrence
+template <class T>
+struct ArgExtremum {
+  T value{};
+  size_t index = 0;
+  bool found = false;
+};
+
+template <class Backend, class T, class Less>
+ArgExtremum<T> ArgExtremumOf(std::span<const T> data, Less less) {
+  auto map = [&](size_t begin, size_t end) {
+    // Value is found with per-lane extremums, which vectorizes, and its first index by second pass over chunk
+    std::array<T, kNumAccumulators> best;
+    best.fill(data[begin]);
+    size_t i = begin;
+    for (; i + kNumAccumulators <= end; i += kNumAccumulators) {
+      for (size_t k = 0; k < kNumAccumulators; k++) {
+        best[k] = less(data[i + k], best[k]) ? data[i + k] : best[k];
+      }
+    }
+    for (; i < end; i++) {
+      best[0] = less(data[i], best[0]) ? data[i] : best[0];
+    }
+    T value = *std::min_element(best.begin(), best.end(), less);
+    auto chunk = data.subspan(begin, end - begin);
+    auto first = std::find(chunk.begin(), chunk.end(), value);
+    return ArgExtremum<T>{value, begin + static_cast<size_t>(first - chunk.begin()), true};
+  };
+  auto combine = [&](ArgExtremum<T> lhs, ArgExtremum<T> rhs) {
+    // Chunks are combined in order, so equal value of right chunk has larger index
+    if (!lhs.found || (rhs.found && less(rhs.value, lhs.value))) {
+      return rhs;
+    }
+    return lhs;
+  };
+  return Reduce<Backend>(data.size(), ArgExtremum<T>{}, map, combine);
+}
+
+}  // namespace detail
+
+// Sum of elements accumulated in Acc
+template <class Acc, class Backend = ppc::par::Seq, class T>
+Acc Sum(std::span<const T> data) {
+  return detail::Reduce<Backend>(
+      data.size(), Acc{},
+      [&](size_t begin, size_t end) {
+        return detail::SumRange<Acc>(begin, end, [&](size_t i) { return static_cast<Acc>(data[i]); });
+      },
+      [](Acc lhs, Acc rhs) { return lhs + rhs; });
+}
+
+// Dot product of vectors of equal size accumulated in Acc
+template <class Acc, class Backend = ppc::par::Seq, class T>
+Acc Dot(std::span<const T> lhs, std::span<const T> rhs) {
+  return detail::Reduce<Backend>(
+      std::min(lhs.size(), rhs.size()), Acc{},
+      [&](size_t begin, size_t end) {
+        return detail::SumRange<Acc>(begin, end,
+                                     [&](size_t i) { return static_cast<Acc>(lhs[i]) * static_cast<Acc>(rhs[i]); });
+      },
+      [](Acc a, Acc b) { return a + b; });
+}
+
+// Minimum and index of its first occurrence, {T{}, 0} for empty input
+template <class Backend = ppc::par::Seq, class T>
+std::pair<T, size_t> MinElement(std::span<const T> data) {
+  auto res = detail::ArgExtremumOf<Backend>(data, [](const T &a, const T &b) { return a < b; });
+  return {res.value, res.index};
+}
+
+// Maximum and index of its first occurrence, {T{}, 0} for empty input
+template <class Backend = ppc::par::Seq, class T>
+std::pair<T, size_t> MaxElement(std::span<const T> data) {
+  auto res = detail::ArgExtremumOf<Backend>(data, [](const T &a, const T &b) { return b < a; });
+  return {res.value, res.index};
+}
+
+// Count of neighbours with opposite signs (zero has no sign). Signs are compared instead of multiplied,
+// so large integers don't overflow
+template <class Backend = ppc::par::Seq, class T>
+size_t CountSignAlternations(std::span<const T> data) {
+  if (data.size() < 2) {
+    return 0;
+  }
+  return detail::Reduce<Backend>(
+      data.size() - 1, size_t{0},
+      [&](size_t begin, size_t end) {
+        return detail::SumRange<size_t>(begin, end, [&](size_t i) {
+          bool neg_pos = data[i] < T{} && T{} < data[i + 1];
+          bool pos_neg = T{} < data[i] && data[i + 1] < T{};
+          return static_cast<size_t>(neg_pos || pos_neg);
+        });
+      },
+      [](size_t a, size_t b) { return a + b; });
+}
+
+}  // namespace ppc::reference
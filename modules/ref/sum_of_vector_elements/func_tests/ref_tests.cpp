@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 
+#include "core/par/include/par.hpp"
 #include "core/task/include/task.hpp"
 #include "ref/sum_of_vector_elements/include/ref_task.hpp"
 
@@ -122,3 +123,23 @@ TEST(sum_of_vector_elements, check_float) {
   test_task.PostProcessing();
   EXPECT_NEAR(out[0], static_cast<float>(in.size()), 1e-3F);
 }
+
+TEST(sum_of_vector_elements, check_double_fractions) {
+  // Create data
+  std::vector<double> in(1001, 0.5);
+  std::vector<double> out(1, 0);
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+  // Create Task
+  ppc::reference::SumOfVectorElements<double, ppc::par::Stl> test_task(task_data);
+  bool is_valid = test_task.Validation();
+  ASSERT_EQ(is_valid, true);
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  ASSERT_DOUBLE_EQ(out[0], 500.5);
+}
@@ -1,24 +1,23 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
-#include <numeric>
-#include <vector>
+#include <span>
 
+#include "core/par/include/par.hpp"
 #include "core/task/include/task.hpp"
+#include "ref/reductions/include/reductions.hpp"
 
 namespace ppc::reference {
 
-template <class InOutType>
+template <class InOutType, class Backend = ppc::par::Seq>
 class SumOfVectorElements : public ppc::core::Task {
  public:
   explicit SumOfVectorElements(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<InOutType>(task_data->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(task_data->inputs[0]);
-    for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // Input is read in place
+    input_ = std::span<const InOutType>(reinterpret_cast<const InOutType*>(task_data->inputs[0]),
+                                        task_data->inputs_count[0]);
     // Init value for output
     sum_ = 0;
     return true;
@@ -30,7 +29,7 @@ class SumOfVectorElements : public ppc::core::Task {
   }
 
   bool RunImpl() override {
-    sum_ = std::accumulate(input_.begin(), input_.end(), 0);
+    sum_ = static_cast<InOutType>(Sum<WideAccumulator<InOutType>, Backend>(input_));
     return true;
   }
 
@@ -40,7 +39,7 @@ class SumOfVectorElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  std::span<const InOutType> input_;
   InOutType sum_;
 };
 
@@ -1,28 +1,26 @@
 #ifndef MODULES_REFERENCE_VECTOR_DOT_PRODUCT_REF_TASK_HPP_
 #define MODULES_REFERENCE_VECTOR_DOT_PRODUCT_REF_TASK_HPP_
 
+#include <array>
 #include <cstddef>
 #include <memory>
-#include <numeric>
-#include <vector>
+#include <span>
 
+#include "core/par/include/par.hpp"
 #include "core/task/include/task.hpp"
+#include "ref/reductions/include/reductions.hpp"
 
 namespace ppc::reference {
 
-template <class InOutType>
+template <class InOutType, class Backend = ppc::par::Seq>
 class VectorDotProduct : public ppc::core::Task {
  public:
   explicit VectorDotProduct(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<std::vector<InOutType> >(2);
+    // Inputs are read in place
     for (size_t i = 0; i < input_.size(); i++) {
-      input_[i] = std::vector<InOutType>(task_data->inputs_count[i]);
-      auto tmp_ptr = reinterpret_cast<InOutType*>(task_data->inputs[i]);
-      for (unsigned j = 0; j < task_data->inputs_count[i]; j++) {
-        input_[i][j] = tmp_ptr[j];
-      }
+      input_[i] = std::span<const InOutType>(reinterpret_cast<const InOutType*>(task_data->inputs[i]),
+                                             task_data->inputs_count[i]);
     }
 
     // Init value for output
@@ -36,7 +34,7 @@ class VectorDotProduct : public ppc::core::Task {
   }
 
   bool RunImpl() override {
-    dor_product_ = std::inner_product(input_[0].begin(), input_[0].end(), input_[1].begin(), 0.0);
+    dor_product_ = static_cast<InOutType>(Dot<WideAccumulator<InOutType>, Backend>(input_[0], input_[1]));
     return true;
   }
 
@@ -46,7 +44,7 @@ class VectorDotProduct : public ppc::core::Task {
   }
 
  private:
-  std::vector<std::vector<InOutType> > input_;
+  std::array<std::span<const InOutType>, 2> input_;
   InOutType dor_product_;
 };
 
@@ -3,6 +3,8 @@ from collections import defaultdict
 import argparse
 import yaml
 
+import perf_history
+
 task_types = ['all', 'mpi', 'omp', 'seq', 'stl', 'tbb']
 
 tasks_dir = Path('tasks')
@@ -40,6 +42,7 @@ html_content = f"""
 <body>
     <h1>Scoreboard</h1>
     <h3 style="color: red;">Note:</b> This is experimental and results are for reference only!</h3>
+    <p><a href="performance.html">Performance history</a></p>
     <p>
         <b>(S)olution</b> - The correctness and completeness of the implemented solution.<br/>
         <b>(A)cceleration</b> - The process of speeding up software to improve performance.
@@ -103,6 +106,12 @@ html_content += """
 
 parser = argparse.ArgumentParser(description='Generate HTML scoreboard.')
 parser.add_argument('-o', '--output', type=str, required=True, help='Output file path')
+parser.add_argument('--perf-history', type=str, default=str(Path(__file__).parent / "data" / "perf_history.jsonl"),
+                    help='JSON lines with perf records of previous runs')
+parser.add_argument('--perf-report', type=str, action='append', default=[],
+                    help='PPC_PERF_REPORT_FILE .jsonl of new run, it is appended to perf history (can be repeated)')
+parser.add_argument('--perf-type', type=str, default='task_run', choices=['task_run', 'pipeline'],
+                    help='Type of perf tests shown on performance page')
 args = parser.parse_args()
 
 output_file = Path(args.output) / "index.html"
@@ -110,3 +119,8 @@ with open(output_file, 'w') as file:
     file.write(html_content)
 
 print(f"HTML page generated at {output_file}")
+
+if args.perf_report:
+    perf_history.append_reports(Path(args.perf_history), args.perf_report)
+performance_file = perf_history.write_page(args.output, args.perf_history, args.perf_type)
+print(f"HTML page generated at {performance_file}")
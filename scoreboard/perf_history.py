@@ -0,0 +1,211 @@
+"""Performance history of tasks for the scoreboard.
+
+History is a JSON lines file with records of ppc::core::PerfReport (PPC_PERF_REPORT_FILE), every record is stamped
+with time and commit of the run it comes from.
+"""
+import datetime
+import json
+import subprocess
+import sys
+from collections import defaultdict
+from html import escape
+from pathlib import Path
+
+sys.path.insert(0, str(Path(__file__).resolve().parent.parent / "scripts"))
+from perf_records import read_records, record_key, run_time  # noqa: E402
+
+parallel_types = ['omp', 'tbb', 'stl', 'all', 'mpi']
+colors = {'seq': '#555555', 'omp': '#1f77b4', 'tbb': '#ff7f0e', 'stl': '#2ca02c', 'all': '#d62728', 'mpi': '#9467bd'}
+
+
+def current_commit():
+    try:
+        result = subprocess.run(["git", "rev-parse", "--short", "HEAD"], stdout=subprocess.PIPE,
+                                stderr=subprocess.DEVNULL, text=True)
+        return result.stdout.strip() if result.returncode == 0 else ""
+    except OSError:
+        return ""
+
+
+def append_reports(history_path, report_paths):
+    stamp = datetime.datetime.now(datetime.timezone.utc).isoformat(timespec="seconds")
+    commit = current_commit()
+    history_path.parent.mkdir(parents=True, exist_ok=True)
+    with open(history_path, "a") as history_file:
+        for report_path in report_paths:
+            for record in read_records(report_path, types=None):
+                record.setdefault("timestamp", stamp)
+                record.setdefault("commit", commit)
+                history_file.write(json.dumps(record) + "\n")
+
+
+def load_history(history_path, perf_type):
+    if not history_path.exists():
+        return []
+    return [record for record in read_records(history_path, types=[perf_type]) if run_time(record) > 0]
+
+
+def line_chart(title, series, y_label, ideal=None, x_label=str):
+    """Inline SVG with one polyline per technology, sorted x values are placed evenly as categories."""
+    width, height, left, bottom, top, right = 380, 230, 45, 35, 25, 80
+    xs = sorted({x for points in series.values() for x, _ in points})
+    ys = [y for points in series.values() for _, y in points]
+    if ideal:
+        ys += [ideal(x) for x in xs]
+    if not xs or not ys:
+        return ""
+    y_max = max(ys) * 1.1 or 1.0
+    plot_w, plot_h = width - left - right, height - top - bottom
+
+    def px(x):
+        return left + (xs.index(x) + 0.5) * plot_w / len(xs)
+
+    def py(y):
+        return top + plot_h - y / y_max * plot_h
+
+    svg = [f'<svg xmlns="http://www.w3.org/2000/svg" width="{width}" height="{height}" class="chart">',
+           f'<text x="{width / 2}" y="15" text-anchor="middle" font-weight="bold">{escape(title)}</text>',
+           f'<line x1="{left}" y1="{top + plot_h}" x2="{left + plot_w}" y2="{top + plot_h}" stroke="black"/>',
+           f'<line x1="{left}" y1="{top}" x2="{left}" y2="{top + plot_h}" stroke="black"/>',
+           f'<text x="10" y="{top + plot_h / 2}" transform="rotate(-90 10 {top + plot_h / 2})" '
+           f'text-anchor="middle" font-size="11">{escape(y_label)}</text>']
+    for i in range(5):
+        value = y_max * i / 4
+        svg.append(f'<text x="{left - 4}" y="{py(value) + 4:.1f}" text-anchor="end" font-size="10">{value:.2f}</text>')
+    for x in xs:
+        svg.append(f'<text x="{px(x):.1f}" y="{top + plot_h + 14}" text-anchor="middle" font-size="10">'
+                   f'{escape(x_label(x))}</text>')
+    if ideal:
+        points = " ".join(f"{px(x):.1f},{py(ideal(x)):.1f}" for x in xs)
+        svg.append(f'<polyline points="{points}" fill="none" stroke="#aaaaaa" stroke-dasharray="4 3"/>')
+    for i, (name, points) in enumerate(sorted(series.items())):
+        color = colors.get(name, "#000000")
+        coords = " ".join(f"{px(x):.1f},{py(y):.1f}" for x, y in sorted(points, key=lambda p: xs.index(p[0])))
+        svg.append(f'<polyline points="{coords}" fill="none" stroke="{color}" stroke-width="2"/>')
+        for x, y in points:
+            svg.append(f'<circle cx="{px(x):.1f}" cy="{py(y):.1f}" r="3" fill="{color}">'
+                       f'<title>{escape(name)} {escape(x_label(x))}: {y:.3f}</title></circle>')
+        svg.append(f'<text x="{left + plot_w + 10}" y="{top + 12 + 14 * i}" fill="{color}" font-size="11">'
+                   f'{escape(name)}</text>')
+    svg.append('</svg>')
+    return "".join(svg)
+
+
+def seq_times_by_size(records):
+    """Fastest sequential time for every input size, parallel runs are compared only with seq on the same input."""
+    seq_times = {}
+    for record in records:
+        if record["technology"] == "seq":
+            size = record.get("input_size", 0)
+            seq_times[size] = min(seq_times.get(size, run_time(record)), run_time(record))
+    return seq_times
+
+
+def summarize(records):
+    """Latest measurement of every configuration and speedup history of every task.
+
+    Tables and scaling charts use the largest input size which has both seq and parallel measurements.
+    """
+    by_task = defaultdict(list)
+    for record in records:
+        by_task[record["task"]].append(record)
+
+    summary = {}
+    for task_name, task_records in by_task.items():
+        # Later records of the same configuration replace older ones
+        latest = {}
+        for record in sorted(task_records, key=lambda r: r.get("timestamp", "")):
+            key = (*record_key(record), record["technology"], record["num_threads"])
+            latest[key] = record
+        seq_times = seq_times_by_size(latest.values())
+        compared = [r.get("input_size", 0) for r in latest.values()
+                    if r["technology"] in parallel_types and r.get("input_size", 0) in seq_times]
+        input_size = max(compared) if compared else max(r.get("input_size", 0) for r in latest.values())
+        sized = [r for r in latest.values() if r.get("input_size", 0) == input_size]
+        seq_time = seq_times.get(input_size)
+
+        scaling = defaultdict(list)
+        for record in sized:
+            tech, threads = record["technology"], record["num_threads"]
+            if tech in parallel_types and seq_time:
+                speedup = seq_time / run_time(record)
+                scaling[tech].append((threads, speedup, speedup / max(threads, 1)))
+        fastest = min(sized, key=run_time)
+
+        # Speedup at the largest thread count of every run, seq of the same run and input size is the reference
+        history = defaultdict(list)
+        runs = defaultdict(list)
+        for record in task_records:
+            runs[record.get("timestamp", "")].append(record)
+        for stamp in sorted(runs):
+            run_seq = seq_times_by_size(runs[stamp])
+            for tech in parallel_types:
+                tech_records = [r for r in runs[stamp] if r["technology"] == tech and r.get("input_size", 0) in run_seq]
+                if tech_records:
+                    widest = max(tech_records, key=lambda r: (r["num_threads"], r.get("input_size", 0)))
+                    history[tech].append((stamp, run_seq[widest.get("input_size", 0)] / run_time(widest)))
+
+        summary[task_name] = {"seq_time": seq_time, "input_size": input_size, "scaling": scaling, "fastest": fastest,
+                              "history": history, "technologies": sorted({r["technology"] for r in latest.values()})}
+    return summary
+
+
+def render_page(history_path, perf_type="task_run"):
+    summary = summarize(load_history(history_path, perf_type))
+    html = f"""
+<!DOCTYPE html>
+<html>
+<head>
+    <title>Performance</title>
+    <link rel="stylesheet" type="text/css" href="static/main.css">
+</head>
+<body>
+    <h1>Performance ({escape(perf_type)})</h1>
+    <p><a href="index.html">Scoreboard</a></p>
+    <p>
+        Speedup = T(seq) / T(parallel), Efficiency = Speedup / NumThreads. Latest measurement of every technology and
+        count of threads is shown, the fastest implementation of every algorithm is highlighted. Speedup is computed
+        against seq on the same input size only.
+    </p>
+"""
+    if not summary:
+        return html + f"<p>No perf history in {escape(str(history_path))}</p></body></html>"
+
+    html += "<table><tr><th>Task</th><th>T(seq), s</th><th>Fastest</th><th>Threads</th><th>Time, s</th>" \
+            "<th>Input size</th><th>Speedup</th><th>Efficiency</th><th>Technologies</th></tr>"
+    for task_name in sorted(summary):
+        info = summary[task_name]
+        record = info["fastest"]
+        tech, threads = record["technology"], record["num_threads"]
+        speedup = info["seq_time"] / run_time(record) if info["seq_time"] else None
+        cells = [f'<td><a href="#{escape(task_name)}">{escape(task_name)}</a></td>',
+                 f'<td>{info["seq_time"]:.4f}</td>' if info["seq_time"] else '<td>-</td>',
+                 f'<td style="background-color: lightgreen;"><b>{escape(tech)}</b></td>',
+                 f'<td>{threads}</td>', f'<td>{run_time(record):.4f}</td>', f'<td>{info["input_size"]}</td>',
+                 f'<td>{speedup:.2f}</td>' if speedup else '<td>-</td>',
+                 f'<td>{speedup / max(threads, 1) * 100:.1f}%</td>' if speedup else '<td>-</td>',
+                 f'<td>{escape(", ".join(info["technologies"]))}</td>']
+        html += "<tr>" + "".join(cells) + "</tr>"
+    html += "</table>"
+
+    for task_name in sorted(summary):
+        info = summary[task_name]
+        if not info["scaling"]:
+            continue
+        speedups = {tech: [(t, s) for t, s, _ in points] for tech, points in info["scaling"].items()}
+        efficiencies = {tech: [(t, e) for t, _, e in points] for tech, points in info["scaling"].items()}
+        html += f'<h2 id="{escape(task_name)}">{escape(task_name)}</h2><div>'
+        html += line_chart("Speedup by threads", speedups, "speedup", ideal=lambda threads: threads)
+        html += line_chart("Efficiency by threads", efficiencies, "efficiency", ideal=lambda threads: 1.0)
+        if any(len(points) > 1 for points in info["history"].values()):
+            html += line_chart("Speedup over runs", info["history"], "speedup",
+                               x_label=lambda stamp: stamp[5:16].replace("T", " "))
+        html += "</div>"
+    return html + "</body></html>"
+
+
+def write_page(output_dir, history_path, perf_type="task_run"):
+    output_file = Path(output_dir) / "performance.html"
+    with open(output_file, "w") as file:
+        file.write(render_page(Path(history_path), perf_type))
+    return output_file
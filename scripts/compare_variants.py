@@ -0,0 +1,150 @@
+import argparse
+import os
+import sys
+from collections import defaultdict
+from pathlib import Path
+
+from perf_records import (list_tests, perf_binary, perf_types, project_path, read_records, record_key,
+                          run_perf_binary, run_time, start_report, technologies)
+
+
+def init_cmd_args():
+    parser = argparse.ArgumentParser(
+        description="Run all technologies of each algorithm on identical inputs, check their outputs agree "
+                    "and print speedup table per algorithm.")
+    parser.add_argument("--tasks", default="",
+                        help="Comma-separated task names (default: every task with at least two technologies).")
+    parser.add_argument("--bin-dir", default="", help="Directory with <technology>_perf_tests binaries.")
+    parser.add_argument("--input", default="",
+                        help="Existing PPC_PERF_REPORT_FILE .jsonl to build tables from, tests aren't run.")
+    parser.add_argument("--report", default="build/perf_stat_dir/variants.jsonl",
+                        help="JSON lines file which collects perf records of the run.")
+    parser.add_argument("--output", default="", help="Markdown file for tables (default: stdout only).")
+    parser.add_argument("--seed", default="42", help="PPC_PERF_SEED for input generators of perf tests.")
+    parser.add_argument("--num-threads", default=str(os.cpu_count()), help="OMP_NUM_THREADS for parallel variants.")
+    parser.add_argument("--mpi-np", default="4", help="Count of processes for all and mpi variants.")
+    return parser.parse_args()
+
+
+def discover_variants(selected):
+    # Variants of one algorithm live in tasks/<technology>/<task_name> with the same task_name
+    variants = defaultdict(list)
+    for technology in technologies:
+        tech_dir = project_path() / "tasks" / technology
+        if not tech_dir.is_dir():
+            continue
+        for task_dir in sorted(tech_dir.iterdir()):
+            if task_dir.is_dir() and not task_dir.name.endswith("_disabled") and (task_dir / "perf_tests").is_dir():
+                variants[task_dir.name].append(technology)
+    if selected:
+        missing = [name for name in selected if name not in variants]
+        if missing:
+            raise Exception(f"Tasks are not found: {', '.join(missing)}")
+        return {name: variants[name] for name in selected}
+    return {name: techs for name, techs in variants.items() if len(techs) > 1}
+
+
+def run_variants(variants, args):
+    report_path, env = start_report(args.report)
+    env["PPC_PERF_SEED"] = args.seed
+
+    # Suite names don't follow task names (e.g. <task>_test_<technology> or suites of other technology), so tests
+    # are selected by source path, the same way PerfReport fills the task field of records
+    for technology in technologies:
+        names = [name for name, techs in variants.items() if technology in techs]
+        binary = perf_binary(args.bin_dir, technology)
+        if not names or not binary.exists():
+            continue
+        tests = [test for test, _, task in list_tests(binary) if task in names]
+        if not tests:
+            print(f"Warning! Perf tests of {', '.join(names)} are not found in {binary.name}", file=sys.stderr)
+            continue
+
+        env["OMP_NUM_THREADS"] = "1" if technology == "seq" else args.num_threads
+        returncode = run_perf_binary(binary, technology, ["--gtest_filter=" + ":".join(tests)], env, args.mpi_np)
+        if returncode:
+            print(f"Warning! {binary.name} returned {returncode}, failed variants are missing in tables",
+                  file=sys.stderr)
+    return report_path
+
+
+def warn_missing(records, variants):
+    for name, techs in sorted(variants.items()):
+        found = {technology for by_size in records[name].values() for by_variant in by_size.values()
+                 for technology, _, _ in by_variant}
+        missing = [technology for technology in techs if technology not in found]
+        if missing:
+            print(f"Warning! Perf records of {name} are missing for {', '.join(missing)}", file=sys.stderr)
+
+
+def collect_records(report_path, variants):
+    # records[task_name][perf_type][input_size][(technology, test, num_threads)] = record
+    records = defaultdict(lambda: defaultdict(lambda: defaultdict(dict)))
+    for record in read_records(report_path):
+        if record["task"] in variants:
+            test, input_size = record_key(record)
+            variant = (record["technology"], test, record["num_threads"])
+            records[record["task"]][record["type_of_running"]][input_size][variant] = record
+    return records
+
+
+def build_table(task_name, perf_type, input_size, by_variant):
+    # Variants are compared only on the same input size, fastest seq test is the reference time and output
+    seq_records = [record for (technology, _, _), record in by_variant.items() if technology == "seq"]
+    seq = min(seq_records, key=run_time) if seq_records else None
+    seq_time = run_time(seq) if seq else None
+    digests = {record.get("output_digest", "") for record in by_variant.values()} - {""}
+    reference = seq.get("output_digest", "") if seq else ""
+    fastest = min(by_variant, key=lambda variant: run_time(by_variant[variant]))
+
+    lines = [f"### {task_name} ({perf_type}, input_size={input_size})", "",
+             "| technology | test | threads | time_sec | speedup | efficiency | output |",
+             "|---|---|---|---|---|---|---|"]
+    for variant in sorted(by_variant, key=lambda v: (technologies.index(v[0]) if v[0] in technologies else 0, *v[1:])):
+        record = by_variant[variant]
+        technology, test, _ = variant
+        time_sec = run_time(record)
+        speedup = efficiency = "-"
+        if seq_time is not None and time_sec > 0:
+            speedup_value = seq_time / time_sec
+            speedup = f"{speedup_value:.2f}"
+            efficiency = f"{speedup_value / max(record['num_threads'], 1):.2f}"
+        digest = record.get("output_digest", "")
+        if not digest:
+            output = "-"
+        elif len(digests) == 1 or digest == reference:
+            output = "ok"
+        else:
+            output = f"MISMATCH {digest}"
+        name = f"**{technology}**" if variant == fastest else technology
+        lines.append(f"| {name} | {test} | {record['num_threads']} | {time_sec:.4f} | {speedup} | {efficiency} "
+                     f"| {output} |")
+    lines.append("")
+    return lines, len(digests) > 1
+
+
+if __name__ == "__main__":
+    args = init_cmd_args()
+    selected = [name for name in args.tasks.split(",") if name]
+    variants = discover_variants(selected)
+    report = Path(args.input) if args.input else run_variants(variants, args)
+    records = collect_records(report, variants)
+    warn_missing(records, variants)
+
+    output_lines = []
+    mismatches = []
+    for task_name in sorted(records):
+        for perf_type in perf_types:
+            for input_size, by_variant in sorted(records[task_name][perf_type].items()):
+                lines, mismatch = build_table(task_name, perf_type, input_size, by_variant)
+                output_lines += lines
+                if mismatch:
+                    mismatches.append(f"{task_name} ({perf_type}, input_size={input_size})")
+
+    print("\n".join(output_lines))
+    if args.output:
+        Path(args.output).parent.mkdir(parents=True, exist_ok=True)
+        Path(args.output).write_text("\n".join(output_lines) + "\n")
+    if mismatches:
+        print(f"Outputs of technologies differ: {', '.join(mismatches)}", file=sys.stderr)
+        sys.exit(1)
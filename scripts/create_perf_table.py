@@ -1,11 +1,13 @@
 import argparse
+import json
 import os
 import re
 import xlsxwriter
 import multiprocessing
 
 parser = argparse.ArgumentParser()
-parser.add_argument('-i', '--input', help='Input file path (logs of perf tests, .txt)', required=True)
+parser.add_argument('-i', '--input', required=True,
+                    help='Input file path (logs of perf tests .txt or PPC_PERF_REPORT_FILE .jsonl)')
 parser.add_argument('-o', '--output', help='Output file path (path to .xlsx table)', required=True)
 args = parser.parse_args()
 logs_path = os.path.abspath(args.input)
@@ -16,32 +18,50 @@ list_of_type_of_tasks = ["all", "mpi", "omp", "seq", "stl", "tbb"]
 result_tables = {"pipeline": {}, "task_run": {}}
 set_of_task_name = []
 
-logs_file = open(logs_path, "r")
-logs_lines = logs_file.readlines()
-for line in logs_lines:
+
+def read_log_results(path):
+    # Legacy stdout format: tasks/<type>/<name>:<perf_type>:<seconds>
     pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        set_of_task_name.append(task_name)
-        result_tables[perf_type][task_name] = {}
+    results = []
+    with open(path, "r") as logs_file:
+        for line in logs_file.readlines():
+            result = re.findall(pattern, line)
+            if len(result):
+                results.append((result[0][0], result[0][1], result[0][2], float(result[0][3])))
+    return results
 
-        for ttype in list_of_type_of_tasks:
-            result_tables[perf_type][task_name][ttype] = -1.0
 
-for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_type = result[0][0]
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        perf_time = float(result[0][3])
-        if perf_time < 0.05:
-            msg = f"Performance time = {perf_time} < 0.05 second : for {task_type} - {task_name} - {perf_type} \n"
-            raise Exception(msg)
-        result_tables[perf_type][task_name][task_type] = perf_time
+def read_json_results(path):
+    # JSON lines written by ppc::core::PerfReport (PPC_PERF_REPORT_FILE)
+    results = []
+    with open(path, "r") as report_file:
+        for line in report_file:
+            if not line.strip():
+                continue
+            record = json.loads(line)
+            if record["type_of_running"] not in result_tables:
+                continue
+            results.append((record["technology"], record["task"], record["type_of_running"], record["time_sec"]))
+    return results
+
+
+if logs_path.endswith(".jsonl") or logs_path.endswith(".json"):
+    perf_results = read_json_results(logs_path)
+else:
+    perf_results = read_log_results(logs_path)
+
+for task_type, task_name, perf_type, perf_time in perf_results:
+    set_of_task_name.append(task_name)
+    result_tables[perf_type][task_name] = {}
+
+    for ttype in list_of_type_of_tasks:
+        result_tables[perf_type][task_name][ttype] = -1.0
+
+for task_type, task_name, perf_type, perf_time in perf_results:
+    if perf_time < 0.05:
+        msg = f"Performance time = {perf_time} < 0.05 second : for {task_type} - {task_name} - {perf_type} \n"
+        raise Exception(msg)
+    result_tables[perf_type][task_name][task_type] = perf_time
 
 
 for table_name in result_tables:
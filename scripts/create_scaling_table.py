@@ -0,0 +1,70 @@
+import argparse
+import csv
+import os
+from collections import defaultdict
+
+from perf_records import perf_types, read_records, record_key, run_time
+
+parser = argparse.ArgumentParser()
+parser.add_argument('-i', '--input', required=True,
+                    help='Input file path (PPC_PERF_REPORT_FILE .jsonl from --running-type=performance-scaling)')
+parser.add_argument('-o', '--output', required=True, help='Output directory path (for scaling tables .csv and .md)')
+args = parser.parse_args()
+report_path = os.path.abspath(args.input)
+output_path = os.path.abspath(args.output)
+
+parallel_types = ["omp", "tbb", "stl"]
+
+
+def fmt(value):
+    return "-" if value is None else (f"{value:.4f}" if isinstance(value, float) else str(value))
+
+
+# times[perf_type][task_name][task_type][(test, input_size)][num_threads] = seconds
+times = defaultdict(lambda: defaultdict(lambda: defaultdict(lambda: defaultdict(dict))))
+for record in read_records(report_path):
+    task_times = times[record["type_of_running"]][record["task"]]
+    task_times[record["technology"]][record_key(record)][record["num_threads"]] = run_time(record)
+
+
+def seq_times_by_size(task_times):
+    # Suites of seq and parallel variants are named differently, so parallel runs are matched with seq by input size
+    seq_times = {}
+    for (_, input_size), by_threads in task_times.get("seq", {}).items():
+        for seq_time in by_threads.values():
+            seq_times[input_size] = min(seq_times.get(input_size, seq_time), seq_time)
+    return seq_times
+
+
+header = ["task", "technology", "test", "input_size", "num_threads", "time_sec", "seq_time_sec", "speedup",
+          "efficiency"]
+for perf_type in perf_types:
+    rows = []
+    for task_name in sorted(times[perf_type]):
+        task_times = times[perf_type][task_name]
+        seq_times = seq_times_by_size(task_times)
+        for task_type in parallel_types:
+            for (test, input_size), by_threads in sorted(task_times.get(task_type, {}).items()):
+                seq_time = seq_times.get(input_size)
+                for num_threads in sorted(by_threads):
+                    par_time = by_threads[num_threads]
+                    if seq_time is None or par_time <= 0:
+                        speedup = efficiency = None
+                    else:
+                        speedup = seq_time / par_time
+                        efficiency = speedup / num_threads
+                    rows.append([task_name, task_type, test, input_size, num_threads, par_time, seq_time, speedup,
+                                 efficiency])
+
+    with open(os.path.join(output_path, perf_type + '_scaling_table.csv'), 'w', newline='') as csv_file:
+        writer = csv.writer(csv_file)
+        writer.writerow(header)
+        writer.writerows(rows)
+
+    with open(os.path.join(output_path, perf_type + '_scaling_table.md'), 'w') as md_file:
+        md_file.write("| " + " | ".join(header) + " |\n")
+        md_file.write("|" + "---|" * len(header) + "\n")
+        for row in rows:
+            md_file.write("| " + " | ".join(fmt(value) for value in row) + " |\n")
+
+print(f"Scaling tables generated in {output_path}")
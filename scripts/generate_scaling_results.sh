@@ -0,0 +1,5 @@
+set -o pipefail
+
+mkdir -p build/perf_stat_dir
+python3 scripts/run_tests.py --running-type="performance-scaling" --scaling-report build/perf_stat_dir/scaling.jsonl
+python3 scripts/create_scaling_table.py --input build/perf_stat_dir/scaling.jsonl --output build/perf_stat_dir
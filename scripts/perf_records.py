@@ -0,0 +1,94 @@
+"""Helpers shared by perf scripts: running <technology>_perf_tests binaries and reading records of
+ppc::core::PerfReport (PPC_PERF_REPORT_FILE with PPC_PERF_REPORT_FORMAT=json).
+"""
+import json
+import os
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+technologies = ["seq", "omp", "tbb", "stl", "all", "mpi"]
+mpi_technologies = ["all", "mpi"]
+perf_types = ["pipeline", "task_run"]
+
+
+def project_path():
+    return Path(__file__).resolve().parent.parent
+
+
+def default_bin_dir():
+    for candidate in ["build/bin", "install/bin"]:
+        if (project_path() / candidate).is_dir():
+            return project_path() / candidate
+    return project_path() / "build/bin"
+
+
+def perf_binary(bin_dir, technology):
+    return (Path(bin_dir) if bin_dir else default_bin_dir()) / f"{technology}_perf_tests"
+
+
+def start_report(report):
+    """Empty JSON lines report and environment which makes perf binaries write their records to it."""
+    report_path = Path(report).resolve()
+    report_path.parent.mkdir(parents=True, exist_ok=True)
+    if report_path.exists():
+        report_path.unlink()
+    env = dict(os.environ)
+    env["PPC_PERF_REPORT_FILE"] = str(report_path)
+    env["PPC_PERF_REPORT_FORMAT"] = "json"
+    return report_path, env
+
+
+def run_perf_binary(binary, technology, gtest_args, env, mpi_np="4"):
+    """Exit code of perf binary, None if it is not built. All and mpi binaries are started with mpirun."""
+    if not binary.exists():
+        print(f"Warning! {binary} is not found", file=sys.stderr)
+        return None
+    command = [str(binary), "--gtest_color=0"] + gtest_args
+    if technology in mpi_technologies:
+        command = ["mpirun", "-np", mpi_np] + command
+    return subprocess.run(command, env=env).returncode
+
+
+def parse_test_path(path):
+    """Technology and task of test source, the same rule as PerfReport::ParseTestPath."""
+    parts = Path(path).parts
+    for i in range(len(parts) - 1, 1, -1):
+        if parts[i] in ["perf_tests", "func_tests"]:
+            return parts[i - 2], parts[i - 1]
+    return "unknown", "unknown"
+
+
+def list_tests(binary):
+    """Full names of tests in perf binary with technology and task of their source files."""
+    with tempfile.TemporaryDirectory() as list_dir:
+        list_path = Path(list_dir) / "tests.json"
+        subprocess.run([str(binary), "--gtest_list_tests", f"--gtest_output=json:{list_path}"],
+                       stdout=subprocess.DEVNULL, check=True)
+        listing = json.loads(list_path.read_text())
+    return [(f"{suite['name']}.{test['name']}", *parse_test_path(test.get("file", "")))
+            for suite in listing.get("testsuites", []) for test in suite.get("testsuite", [])]
+
+
+def read_records(report_path, types=perf_types):
+    """Records of report or history file, only ones of given types of running (all records if types is None)."""
+    with open(report_path, "r") as report_file:
+        for line in report_file:
+            if not line.strip():
+                continue
+            record = json.loads(line)
+            if types is None or record.get("type_of_running") in types:
+                yield record
+
+
+def record_key(record):
+    # One perf test may measure several input sizes (PPC_PERF_SIZES), each of them is a separate measurement
+    return record.get("test", ""), record.get("input_size", 0)
+
+
+def run_time(record):
+    # Median of single run is robust to outliers, total time is used for reports without samples
+    if record.get("num_running", 0) > 0 and record.get("median_sec", 0.0) > 0.0:
+        return record["median_sec"]
+    return record["time_sec"]
@@ -0,0 +1,185 @@
+import argparse
+import json
+import math
+import sys
+from collections import defaultdict
+from pathlib import Path
+
+from perf_records import perf_binary, read_records, record_key, run_perf_binary, start_report, technologies
+
+
+def init_cmd_args():
+    parser = argparse.ArgumentParser(
+        description="Record perf baseline or compare current perf results with it. Regression is reported when "
+                    "samples are significantly slower (one-sided Mann-Whitney U test) and median slowed beyond "
+                    "threshold.")
+    subparsers = parser.add_subparsers(dest="command", required=True)
+    for name in ["record", "compare"]:
+        sub = subparsers.add_parser(name)
+        sub.add_argument("--baseline", default="build/perf_stat_dir/perf_baseline.json", help="Baseline JSON file.")
+        sub.add_argument("--input", default="",
+                         help="Existing PPC_PERF_REPORT_FILE .jsonl instead of running perf binaries.")
+        sub.add_argument("--bin-dir", default="", help="Directory with <technology>_perf_tests binaries.")
+        sub.add_argument("--report", default=f"build/perf_stat_dir/{name}.jsonl",
+                         help="JSON lines file which collects perf records of the run.")
+        sub.add_argument("--technologies", default="seq,omp,tbb,stl",
+                         help="Comma-separated technologies to run (all and mpi are started with mpirun).")
+        sub.add_argument("--filter", default="", help="gtest filter for perf binaries, e.g. '*example*'.")
+        sub.add_argument("--repeats", type=int, default=1,
+                         help="Repeats of every perf test, samples of all repeats are merged.")
+        sub.add_argument("--num-threads", default="", help="OMP_NUM_THREADS (default: keep environment).")
+        sub.add_argument("--mpi-np", default="4", help="Count of processes for all and mpi binaries.")
+    compare = subparsers.choices["compare"]
+    compare.add_argument("--threshold", type=float, default=0.1,
+                         help="Minimal relative slowdown of median which is reported (0.1 = 10%%).")
+    compare.add_argument("--alpha", type=float, default=0.01, help="Significance level of Mann-Whitney U test.")
+    compare.add_argument("--allow-missing", action="store_true",
+                         help="Don't fail on baseline tests without current results (removed on purpose or "
+                              "excluded by --filter).")
+    return parser.parse_args()
+
+
+def run_perf(args):
+    """Report of perf binaries and names of binaries which are not found or failed."""
+    report_path, env = start_report(args.report)
+    # Slow task is a finding of comparison, it must not abort the rest of binary
+    env["PPC_TIME_LIMIT_MODE"] = "record"
+    if args.num_threads:
+        env["OMP_NUM_THREADS"] = args.num_threads
+
+    failed = []
+    for technology in [tech for tech in args.technologies.split(",") if tech]:
+        if technology not in technologies:
+            raise Exception(f"Unknown technology: {technology}")
+        gtest_args = [f"--gtest_repeat={args.repeats}"]
+        if args.filter:
+            gtest_args.append(f"--gtest_filter={args.filter}")
+        binary = perf_binary(args.bin_dir, technology)
+        returncode = run_perf_binary(binary, technology, gtest_args, env, args.mpi_np)
+        if returncode != 0:
+            failed.append(binary.name)
+    return report_path, failed
+
+
+def current_samples(args):
+    if args.input:
+        return read_samples(Path(args.input)), []
+    report_path, failed = run_perf(args)
+    return read_samples(report_path), failed
+
+
+baseline_version = 2
+
+
+def entry_key(record):
+    test, input_size = record_key(record)
+    return (f"{record['technology']}/{record['task']}/{test}:{record['type_of_running']}:"
+            f"threads={record['num_threads']}:size={input_size}")
+
+
+def read_samples(report_path):
+    # samples[task key] = times of single runs over all repeats
+    samples = defaultdict(list)
+    for record in read_records(report_path):
+        samples[entry_key(record)] += record.get("samples") or [record["time_sec"]]
+    return samples
+
+
+def median(values):
+    ordered = sorted(values)
+    middle = len(ordered) // 2
+    return ordered[middle] if len(ordered) % 2 else (ordered[middle - 1] + ordered[middle]) / 2
+
+
+def mann_whitney_greater(current, baseline):
+    """P-value of one-sided Mann-Whitney U test that current samples are stochastically greater than baseline.
+
+    Normal approximation with tie and continuity corrections, it is accurate enough from ~5 samples per side.
+    """
+    n1, n2 = len(current), len(baseline)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+    values = sorted([(value, 0) for value in current] + [(value, 1) for value in baseline])
+    ranks = [0.0] * len(values)
+    tie_term = 0.0
+    i = 0
+    while i < len(values):
+        j = i
+        while j + 1 < len(values) and values[j + 1][0] == values[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2 + 1
+        ties = j - i + 1
+        tie_term += ties ** 3 - ties
+        i = j + 1
+    rank_sum = sum(rank for rank, (_, group) in zip(ranks, values) if group == 0)
+    u = rank_sum - n1 * (n1 + 1) / 2
+    n = n1 + n2
+    variance = n1 * n2 / 12 * ((n + 1) - tie_term / (n * (n - 1))) if n > 1 else 0.0
+    if variance <= 0:
+        return 1.0
+    z = (u - n1 * n2 / 2 - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2))
+
+
+def record_baseline(args):
+    samples, failed = current_samples(args)
+    if failed:
+        print(f"Perf binaries are not found or failed: {', '.join(failed)}, baseline isn't written", file=sys.stderr)
+        return 1
+    entries = {key: {"median_sec": median(values), "samples": values} for key, values in sorted(samples.items())}
+    baseline_path = Path(args.baseline)
+    baseline_path.parent.mkdir(parents=True, exist_ok=True)
+    baseline_path.write_text(json.dumps({"version": baseline_version, "entries": entries}, indent=1) + "\n")
+    print(f"Baseline of {len(entries)} perf tests is written to {baseline_path}")
+    return 0
+
+
+def compare_with_baseline(args):
+    baseline = json.loads(Path(args.baseline).read_text())
+    if baseline.get("version") != baseline_version:
+        raise Exception(f"Baseline {args.baseline} has version {baseline.get('version')}, record it again")
+    baseline = baseline["entries"]
+    current, failed = current_samples(args)
+
+    regressions = []
+    print("| test | baseline_sec | current_sec | change | p_value | status |")
+    print("|---|---|---|---|---|---|")
+    for key in sorted(current):
+        if key not in baseline:
+            print(f"| {key} | - | {median(current[key]):.6f} | - | - | new |")
+            continue
+        base_median = baseline[key]["median_sec"]
+        cur_median = median(current[key])
+        change = cur_median / base_median - 1 if base_median > 0 else 0.0
+        p_value = mann_whitney_greater(current[key], baseline[key]["samples"])
+        status = "ok"
+        if change > args.threshold and p_value < args.alpha:
+            status = "REGRESSION"
+            regressions.append(key)
+        elif change < -args.threshold and mann_whitney_greater(baseline[key]["samples"], current[key]) < args.alpha:
+            status = "improved"
+        print(f"| {key} | {base_median:.6f} | {cur_median:.6f} | {change:+.1%} | {p_value:.4f} | {status} |")
+    missing = sorted(set(baseline) - set(current))
+    for key in missing:
+        print(f"| {key} | {baseline[key]['median_sec']:.6f} | - | - | - | missing |")
+
+    status = 0
+    if failed:
+        print(f"Perf binaries are not found or failed: {', '.join(failed)}", file=sys.stderr)
+        status = 1
+    if missing and not args.allow_missing:
+        print(f"Baseline tests without results (use --allow-missing if they are removed on purpose): "
+              f"{', '.join(missing)}", file=sys.stderr)
+        status = 1
+    if regressions:
+        print(f"Performance regressions: {', '.join(regressions)}", file=sys.stderr)
+        status = 1
+    return status
+
+
+if __name__ == "__main__":
+    cmd_args = init_cmd_args()
+    if cmd_args.command == "record":
+        sys.exit(record_baseline(cmd_args))
+    sys.exit(compare_with_baseline(cmd_args))
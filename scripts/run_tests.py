@@ -1,6 +1,7 @@
 import os
 import subprocess
 import platform
+import multiprocessing
 from pathlib import Path
 
 
@@ -10,9 +11,21 @@ def init_cmd_args():
     parser.add_argument(
         "--running-type",
         required=True,
-        choices=["threads", "processes", "performance", "performance-list"],
+        choices=["threads", "processes", "performance", "performance-list", "performance-scaling"],
         help="Specify the execution mode. Choose 'threads' for multithreading or 'processes' for multiprocessing."
     )
+    parser.add_argument(
+        "--thread-ladder",
+        required=False,
+        default="",
+        help="Comma-separated thread counts for 'performance-scaling' mode (default: 1,2,4,...,nproc)."
+    )
+    parser.add_argument(
+        "--scaling-report",
+        required=False,
+        default="build/perf_stat_dir/scaling.jsonl",
+        help="JSON lines file with perf records for 'performance-scaling' mode."
+    )
     parser.add_argument(
         "--additional-mpi-args",
         required=False,
@@ -140,6 +153,36 @@ class PPCRunner:
         self.__run_exec(f"{self.work_dir / 'stl_perf_tests'} {self.__get_gtest_settings(1)}")
         self.__run_exec(f"{self.work_dir / 'tbb_perf_tests'} {self.__get_gtest_settings(1)}")
 
+    @staticmethod
+    def get_default_thread_ladder():
+        cpu_num = multiprocessing.cpu_count()
+        ladder = []
+        num_threads = 1
+        while num_threads < cpu_num:
+            ladder.append(num_threads)
+            num_threads *= 2
+        ladder.append(cpu_num)
+        return ladder
+
+    def run_performance_scaling(self, thread_ladder, report_path):
+        report_path = Path(report_path).resolve()
+        report_path.parent.mkdir(parents=True, exist_ok=True)
+        if report_path.exists():
+            report_path.unlink()
+        os.environ["PPC_PERF_REPORT_FILE"] = str(report_path)
+        os.environ["PPC_PERF_REPORT_FORMAT"] = "json"
+
+        # Sequential versions are the baseline, they don't depend on count of threads
+        os.environ["OMP_NUM_THREADS"] = "1"
+        self.__run_exec(f"{self.work_dir / 'seq_perf_tests'} {self.__get_gtest_settings(1)}")
+
+        for num_threads in thread_ladder:
+            os.environ["OMP_NUM_THREADS"] = str(num_threads)
+            for task_type in ["omp", "stl", "tbb"]:
+                if task_type == "omp" and os.environ.get("CLANG_BUILD") == "1":
+                    continue
+                self.__run_exec(f"{self.work_dir / f'{task_type}_perf_tests'} {self.__get_gtest_settings(1)}")
+
     def run_performance_list(self):
         for task_type in ["all", "mpi", "omp", "seq", "stl", "tbb"]:
             self.__run_exec(f"{self.work_dir / f'{task_type}_perf_tests'} --gtest_list_tests")
@@ -162,5 +205,11 @@ if __name__ == "__main__":
         ppc_runner.run_performance()
     elif args_dict["running_type"] == "performance-list":
         ppc_runner.run_performance_list()
+    elif args_dict["running_type"] == "performance-scaling":
+        if args_dict["thread_ladder"]:
+            ladder = [int(num_threads) for num_threads in args_dict["thread_ladder"].split(",")]
+        else:
+            ladder = PPCRunner.get_default_thread_ladder()
+        ppc_runner.run_performance_scaling(ladder, args_dict["scaling_report"])
     else:
         raise Exception("running-type is wrong!")
@@ -1,7 +1,6 @@
 #include "all/example/include/ops_all.hpp"
 
 #include <cmath>
-#include <cstddef>
 #include <functional>
 #include <thread>
 #include <vector>
@@ -24,15 +23,11 @@ void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_v
 }  // namespace
 
 bool nesterov_a_test_task_all::TestTaskALL::PreProcessingImpl() {
-  // Init value for input and output
-  unsigned int input_size = task_data->inputs_count[0];
-  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  input_ = std::vector<int>(in_ptr, in_ptr + input_size);
+  // Init value for input and output, buffers keep their capacity when task is reset or rebound
+  CopyInput(input_, 0);
+  ResetBuffer(output_, task_data->outputs_count[0]);
 
-  unsigned int output_size = task_data->outputs_count[0];
-  output_ = std::vector<int>(output_size, 0);
-
-  rc_size_ = static_cast<int>(std::sqrt(input_size));
+  rc_size_ = static_cast<int>(std::sqrt(input_.size()));
   return true;
 }
 
@@ -71,8 +66,6 @@ bool nesterov_a_test_task_all::TestTaskALL::RunImpl() {
 }
 
 bool nesterov_a_test_task_all::TestTaskALL::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); i++) {
-    reinterpret_cast<int *>(task_data->outputs[0])[i] = output_[i];
-  }
+  CopyOutput(output_, 0);
   return true;
 }
@@ -1,6 +1,5 @@
 #include "../include/mci_all.hpp"
 
-#include <algorithm>
 #include <boost/mpi/collectives/broadcast.hpp>
 #include <boost/mpi/collectives/reduce.hpp>
 #include <boost/serialization/utility.hpp>  // NOLINT(*-include-cleaner)
@@ -8,14 +7,11 @@
 #include <cmath>
 #include <cstddef>
 #include <functional>
-#include <future>
-#include <numeric>
 #include <random>
-#include <thread>
-#include <utility>
 #include <vector>
 
 #include "../include/mci_common.hpp"
+#include "core/par/include/par.hpp"
 #include "core/util/include/util.hpp"
 
 bool krylov_m_monte_carlo::TaskALL::ValidationImpl() { return world_.rank() != 0 || TaskCommon::ValidationImpl(); }
@@ -56,7 +52,7 @@ bool krylov_m_monte_carlo::TaskALL::RunImpl() {
   std::random_device dev;
   std::mt19937 gen(dev());
 
-  const auto calculation_thread = [&](std::size_t local_iterations, std::promise<double>&& promise) {
+  const auto calculation = [&](std::size_t local_iterations) {
     auto local_gen = gen;
     std::vector<double> x(dimensions);
     double partial_sum = 0.;
@@ -66,28 +62,23 @@ bool krylov_m_monte_carlo::TaskALL::RunImpl() {
       }
       partial_sum += func(x);
     }
-
-    promise.set_value(partial_sum);
+    return partial_sum;
   };
 
+  // Portions of workers are computed by warm threads of shared pool, one portion per chunk
   const std::size_t node_workers = ppc::util::GetPPCNumThreads();
-  std::vector<std::future<double>> futures(node_workers);
-  {
-    const std::size_t amount = node_iterations / node_workers;
-    const std::size_t threshold = node_iterations % node_workers;
-
-    std::vector<std::thread> threads(node_workers);
-    for (std::size_t i = 0; i < node_workers; i++) {
-      const std::size_t assigned = amount + ((i < threshold) ? 1 : 0);
-      std::promise<double> promise;
-      futures[i] = promise.get_future();
-      threads[i] = std::thread(calculation_thread, assigned, std::move(promise));
-    }
-    std::ranges::for_each(threads, [](auto& thread) { thread.join(); });
-  }
-
-  const double partial_sum = std::transform_reduce(futures.begin(), futures.end(), 0., std::plus{},
-                                                   [](std::future<double>& future) { return future.get(); });
+  const std::size_t amount = node_iterations / node_workers;
+  const std::size_t threshold = node_iterations % node_workers;
+  const double partial_sum = ppc::par::ParallelReduce<ppc::par::Stl>(
+      std::size_t{0}, node_workers, 0.,
+      [&](std::size_t begin, std::size_t end) {
+        double sum = 0.;
+        for (std::size_t i = begin; i < end; i++) {
+          sum += calculation(amount + ((i < threshold) ? 1 : 0));
+        }
+        return sum;
+      },
+      std::plus{}, 1);
 
   double sum{};
   boost::mpi::reduce(world_, partial_sum, sum, std::plus{}, 0);
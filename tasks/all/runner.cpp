@@ -3,12 +3,15 @@
 
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <memory>
 #include <string>
 #include <utility>
 
+#include "core/util/include/affinity.hpp"
+#include "core/util/include/affinity_tbb.hpp"
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/global_control.h"
 
@@ -66,6 +69,10 @@ int main(int argc, char** argv) {
 
   // Limit the number of threads in TBB
   tbb::global_control control(tbb::global_control::max_allowed_parallelism, ppc::util::GetPPCNumThreads());
+  // Processes on one node get disjoint CPUs, threads of every technology are pinned according to PPC_AFFINITY
+  ppc::util::SetAffinityThreadOffset(static_cast<size_t>(world.rank() * ppc::util::GetPPCNumThreads()));
+  ppc::util::TbbAffinityObserver affinity_observer;
+  ppc::util::PinOpenMPThreads();
 
   ::testing::InitGoogleTest(&argc, argv);
 
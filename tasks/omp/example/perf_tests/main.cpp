@@ -4,90 +4,122 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/size_sweep.hpp"
 #include "core/task/include/task.hpp"
 #include "omp/example/include/ops_omp.hpp"
 
-TEST(nesterov_a_test_task_omp, test_pipeline_run) {
-  constexpr int kCount = 300;
+namespace {
+
+// Identity matrix and output buffer of the same size, task must return input unchanged
+struct IdentityMatrices {
+  std::vector<int> in;
+  std::vector<int> out;
+};
 
+// Input of task for matrix of count x count
+ppc::core::SweepInput GenerateIdentity(uint64_t count) {
   // Create data
-  std::vector<int> in(kCount * kCount, 0);
-  std::vector<int> out(kCount * kCount, 0);
+  auto matrices = std::make_shared<IdentityMatrices>();
+  matrices->in.resize(count * count, 0);
+  matrices->out.resize(count * count, 0);
 
-  for (size_t i = 0; i < kCount; i++) {
-    in[(i * kCount) + i] = 1;
+  for (size_t i = 0; i < count; i++) {
+    matrices->in[(i * count) + i] = 1;
   }
 
   // Create task_data
   auto task_data_omp = std::make_shared<ppc::core::TaskData>();
-  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_omp->inputs_count.emplace_back(in.size());
-  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
-  task_data_omp->outputs_count.emplace_back(out.size());
-
-  // Create Task
-  auto test_task_omp = std::make_shared<nesterov_a_test_task_omp::TestTaskOpenMP>(task_data_omp);
-
-  // Create Perf attributes
-  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
-  perf_attr->num_running = 10;
-  const auto t0 = std::chrono::high_resolution_clock::now();
-  perf_attr->current_timer = [&] {
-    auto current_time_point = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
-    return static_cast<double>(duration) * 1e-9;
-  };
-
-  // Create and init perf results
-  auto perf_results = std::make_shared<ppc::core::PerfResults>();
-
-  // Create Perf analyzer
-  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
-  perf_analyzer->PipelineRun(perf_attr, perf_results);
-  ppc::core::Perf::PrintPerfStatistic(perf_results);
-  ASSERT_EQ(in, out);
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrices->in.data()));
+  task_data_omp->inputs_count.emplace_back(matrices->in.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(matrices->out.data()));
+  task_data_omp->outputs_count.emplace_back(matrices->out.size());
+
+  auto dim = static_cast<double>(count);
+  return {.task_data = task_data_omp,
+          .storage = matrices,
+          .flops = 2.0 * dim * dim * dim,
+          .bytes = 2.0 * dim * dim * sizeof(int)};
 }
 
-TEST(nesterov_a_test_task_omp, test_task_run) {
-  constexpr int kCount = 300;
+std::shared_ptr<ppc::core::Task> CreateTask(ppc::core::TaskDataPtr task_data) {
+  return std::make_shared<nesterov_a_test_task_omp::TestTaskOpenMP>(std::move(task_data));
+}
 
-  // Create data
-  std::vector<int> in(kCount * kCount, 0);
-  std::vector<int> out(kCount * kCount, 0);
+}  // namespace
 
-  for (size_t i = 0; i < kCount; i++) {
-    in[(i * kCount) + i] = 1;
+TEST(nesterov_a_test_task_omp, test_pipeline_run) {
+  constexpr uint64_t kDefaultCount = 300;
+
+  // Matrix size can be changed by PPC_PERF_SIZES to measure task at larger inputs
+  for (auto count : ppc::core::GetPerfSizes(kDefaultCount)) {
+    auto input = GenerateIdentity(count);
+
+    // Create Task
+    auto test_task_omp = CreateTask(input.task_data);
+
+    // Create Perf attributes
+    auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+    perf_attr->num_running = 10;
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    perf_attr->current_timer = [&] {
+      auto current_time_point = std::chrono::high_resolution_clock::now();
+      auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+      return static_cast<double>(duration) * 1e-9;
+    };
+
+    // Create and init perf results
+    auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+    // Create Perf analyzer
+    auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+    perf_analyzer->PipelineRun(perf_attr, perf_results);
+    ppc::core::Perf::PrintPerfStatistic(perf_results);
+    auto matrices = std::static_pointer_cast<IdentityMatrices>(input.storage);
+    ASSERT_EQ(matrices->in, matrices->out);
   }
+}
 
-  // Create task_data
-  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
-  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_omp->inputs_count.emplace_back(in.size());
-  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
-  task_data_omp->outputs_count.emplace_back(out.size());
-
-  // Create Task
-  auto test_task_omp = std::make_shared<nesterov_a_test_task_omp::TestTaskOpenMP>(task_data_omp);
-
-  // Create Perf attributes
-  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
-  perf_attr->num_running = 10;
-  const auto t0 = std::chrono::high_resolution_clock::now();
-  perf_attr->current_timer = [&] {
-    auto current_time_point = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
-    return static_cast<double>(duration) * 1e-9;
-  };
-
-  // Create and init perf results
-  auto perf_results = std::make_shared<ppc::core::PerfResults>();
-
-  // Create Perf analyzer
-  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
-  perf_analyzer->TaskRun(perf_attr, perf_results);
-  ppc::core::Perf::PrintPerfStatistic(perf_results);
-  ASSERT_EQ(in, out);
+TEST(nesterov_a_test_task_omp, test_task_run) {
+  constexpr uint64_t kDefaultCount = 300;
+
+  // Matrix size can be changed by PPC_PERF_SIZES to measure task at larger inputs
+  for (auto count : ppc::core::GetPerfSizes(kDefaultCount)) {
+    auto input = GenerateIdentity(count);
+
+    // Create Task
+    auto test_task_omp = CreateTask(input.task_data);
+
+    // Create Perf attributes
+    auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+    perf_attr->num_running = 10;
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    perf_attr->current_timer = [&] {
+      auto current_time_point = std::chrono::high_resolution_clock::now();
+      auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+      return static_cast<double>(duration) * 1e-9;
+    };
+
+    // Create and init perf results
+    auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+    // Create Perf analyzer
+    auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+    perf_analyzer->TaskRun(perf_attr, perf_results);
+    ppc::core::Perf::PrintPerfStatistic(perf_results);
+    auto matrices = std::static_pointer_cast<IdentityMatrices>(input.storage);
+    ASSERT_EQ(matrices->in, matrices->out);
+  }
+}
+
+TEST(nesterov_a_test_task_omp, test_size_sweep) {
+  // Matrix size doubles from 64 to 256, PPC_PERF_SIZES replaces this ladder
+  ppc::core::SweepAttr attr{.min_size = 64, .max_size = 256, .num_running = 3, .max_time_sec = 2.0};
+  ppc::core::SizeSweep sweep(CreateTask, GenerateIdentity, attr);
+  auto results = sweep.Run();
+  ppc::core::SizeSweep::Print("nesterov_a_test_task_omp", results);
+  ASSERT_FALSE(results.points.empty());
 }
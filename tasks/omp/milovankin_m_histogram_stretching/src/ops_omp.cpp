@@ -6,8 +6,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <utility>
 #include <vector>
 
+#include "core/par/include/par.hpp"
+
 namespace milovankin_m_histogram_stretching_omp {
 
 bool TestTaskOpenMP::ValidationImpl() {
@@ -25,28 +28,23 @@ bool TestTaskOpenMP::PreProcessingImpl() {
 }
 
 bool TestTaskOpenMP::RunImpl() {
-  uint8_t min_val = std::numeric_limits<uint8_t>::max();
-  uint8_t max_val = std::numeric_limits<uint8_t>::min();
   const size_t size = img_.size();
 
-// Parallel min/max finding using reduction
-#pragma omp parallel
-  {
-    uint8_t local_min = std::numeric_limits<uint8_t>::max();
-    uint8_t local_max = std::numeric_limits<uint8_t>::min();
-
-#pragma omp for nowait
-    for (long long i = 0; i < static_cast<long long>(size); i++) {
-      local_min = std::min(local_min, img_[i]);
-      local_max = std::max(local_max, img_[i]);
-    }
-
-#pragma omp critical
-    {
-      min_val = std::min(min_val, local_min);
-      max_val = std::max(max_val, local_max);
-    }
-  }
+  // Parallel min/max finding using reduction
+  using MinMax = std::pair<uint8_t, uint8_t>;
+  const MinMax minmax = ppc::par::ParallelReduce<ppc::par::Omp>(
+      0, size, MinMax{std::numeric_limits<uint8_t>::max(), std::numeric_limits<uint8_t>::min()},
+      [this](size_t begin, size_t end) {
+        MinMax local{std::numeric_limits<uint8_t>::max(), std::numeric_limits<uint8_t>::min()};
+        for (size_t i = begin; i < end; i++) {
+          local.first = std::min(local.first, img_[i]);
+          local.second = std::max(local.second, img_[i]);
+        }
+        return local;
+      },
+      [](MinMax a, MinMax b) { return MinMax{std::min(a.first, b.first), std::max(a.second, b.second)}; });
+  const uint8_t min_val = minmax.first;
+  const uint8_t max_val = minmax.second;
 
   if (min_val != max_val) {
     const int delta = max_val - min_val;
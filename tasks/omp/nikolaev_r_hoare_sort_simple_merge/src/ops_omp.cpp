@@ -8,6 +8,8 @@
 #include <utility>
 #include <vector>
 
+#include "core/util/include/scratch_arena.hpp"
+
 bool nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP::PreProcessingImpl() {
   vect_size_ = task_data->inputs_count[0];
   auto *vect_ptr = reinterpret_cast<double *>(task_data->inputs[0]);
@@ -59,7 +61,9 @@ bool nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP::RunImpl
       size_t right_end = segments[(2 * i) + 1].second;
 
       size_t merged_size = right_end - left_start + 1;
-      std::vector<double> merged(merged_size);
+      auto &arena = ppc::util::ScratchArena::ThreadLocal();
+      ppc::util::ScratchArena::Scope scope(arena);
+      auto merged = arena.Allocate<double>(merged_size);
 
       size_t i1 = left_start;
       size_t i2 = right_start;
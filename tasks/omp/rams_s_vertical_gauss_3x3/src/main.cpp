@@ -4,16 +4,15 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <vector>
 
 bool rams_s_vertical_gauss_3x3_omp::TaskOmp::PreProcessingImpl() {
   width_ = task_data->inputs_count[0];
   height_ = task_data->inputs_count[1];
-  input_ = std::vector<uint8_t>(task_data->inputs[0], task_data->inputs[0] + (height_ * width_ * 3));
-  auto *k = reinterpret_cast<float *>(task_data->inputs[1]);
-  kernel_ = std::vector<float>(k, k + task_data->inputs_count[2]);
-
-  output_ = std::vector<uint8_t>(input_);
+  // Image is read from caller's memory and filtered straight into output buffer, border pixels are kept as is
+  input_ = task_data->UncheckedInput<const uint8_t>(0, ppc::core::CheckedMul(height_, width_, 3));
+  kernel_ = task_data->UncheckedInput<const float>(1, task_data->inputs_count[2]);
+  output_ = task_data->Output<uint8_t>(0);
+  std::ranges::copy(input_, output_.begin());
 
   return true;
 }
@@ -48,6 +47,5 @@ bool rams_s_vertical_gauss_3x3_omp::TaskOmp::RunImpl() {
 }
 
 bool rams_s_vertical_gauss_3x3_omp::TaskOmp::PostProcessingImpl() {
-  std::ranges::copy(output_, task_data->outputs[0]);
   return true;
 }
@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 
+#include "core/util/include/affinity.hpp"
+
 int main(int argc, char **argv) {
+  // Pin threads of OpenMP team according to PPC_AFFINITY
+  ppc::util::PinOpenMPThreads();
+
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
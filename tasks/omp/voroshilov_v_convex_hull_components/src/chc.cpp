@@ -11,6 +11,8 @@
 #include <utility>
 #include <vector>
 
+#include "core/trace/include/trace.hpp"
+
 using namespace voroshilov_v_convex_hull_components_omp;
 
 Pixel::Pixel(int y_param, int x_param) : y(y_param), x(x_param), value(0) {}
@@ -87,6 +89,7 @@ void voroshilov_v_convex_hull_components_omp::CheckBoundaryPixels(UnionFind* uni
 void voroshilov_v_convex_hull_components_omp::MergeComponentsAcrossAreas(std::vector<Component>& components,
                                                                          Image& image, int area_height,
                                                                          std::vector<int>& end_y) {
+  PPC_TRACE_SCOPE("MergeComponentsAcrossAreas");
   UnionFind union_find;
 
   int width = image.width;
@@ -169,6 +172,7 @@ std::vector<Component> voroshilov_v_convex_hull_components_omp::FindComponentsIn
 }
 
 std::vector<Component> voroshilov_v_convex_hull_components_omp::FindComponentsOMP(Image& image) {
+  PPC_TRACE_SCOPE("FindComponentsOMP");
   Image tmp_image(image);
 
   int num_threads = omp_get_max_threads();
@@ -208,6 +212,7 @@ std::vector<Component> voroshilov_v_convex_hull_components_omp::FindComponentsOM
 
 #pragma omp parallel
   {
+    PPC_TRACE_SCOPE("FindComponentsInArea");
     int thread_id = omp_get_thread_num();
 
     thread_components[thread_id] =
@@ -224,6 +229,7 @@ std::vector<Component> voroshilov_v_convex_hull_components_omp::FindComponentsOM
   int size = static_cast<int>(components.size());
 #pragma omp parallel for schedule(dynamic)
   for (int i = 0; i < size; i++) {
+    PPC_TRACE_SCOPE("SortComponent");
     std::ranges::sort(components[i],
                       [](const Pixel& p1, const Pixel& p2) { return (p1.y < p2.y || (p1.y == p2.y && p1.x < p2.x)); });
   }
@@ -310,6 +316,7 @@ std::vector<Pixel> voroshilov_v_convex_hull_components_omp::QuickHull(Component&
 }
 
 std::vector<Hull> voroshilov_v_convex_hull_components_omp::QuickHullAllOMP(std::vector<Component>& components) {
+  PPC_TRACE_SCOPE("QuickHullAllOMP");
   if (components.empty()) {
     return {};
   }
@@ -319,6 +326,7 @@ std::vector<Hull> voroshilov_v_convex_hull_components_omp::QuickHullAllOMP(std::
 
 #pragma omp parallel for schedule(dynamic)
   for (int i = 0; i < components_size; i++) {
+    PPC_TRACE_SCOPE("QuickHull");
     hulls[i] = QuickHull(components[i]);
   }
 
@@ -327,6 +335,7 @@ std::vector<Hull> voroshilov_v_convex_hull_components_omp::QuickHullAllOMP(std::
 
 std::pair<std::vector<int>, std::vector<int>> voroshilov_v_convex_hull_components_omp::PackHulls(
     std::vector<Hull>& hulls, Image& image) {
+  PPC_TRACE_SCOPE("PackHulls");
   int height = image.height;
   int width = image.width;
 
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "../include/chc.hpp"
+#include "core/trace/include/trace.hpp"
 
 using namespace voroshilov_v_convex_hull_components_omp;
 
@@ -35,6 +36,7 @@ bool voroshilov_v_convex_hull_components_omp::ChcTaskOMP::PreProcessingImpl() {
 }
 
 bool voroshilov_v_convex_hull_components_omp::ChcTaskOMP::RunImpl() {
+  PPC_TRACE_SCOPE("ChcTaskOMP::RunImpl");
   std::vector<Component> components = FindComponentsOMP(imageIn_);
 
   hullsOut_ = QuickHullAllOMP(components);
@@ -2,14 +2,16 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <span>
 #include <vector>
 
+#include "core/util/include/scratch_arena.hpp"
+
 namespace borisov_s_strassen_seq {
 
 namespace {
 
-std::vector<double> MultiplyNaive(const std::vector<double> &a, const std::vector<double> &b, int n) {
-  std::vector<double> c(n * n, 0.0);
+void MultiplyNaive(std::span<const double> a, std::span<const double> b, std::span<double> c, int n) {
   for (int i = 0; i < n; ++i) {
     for (int j = 0; j < n; ++j) {
       double sum = 0.0;
@@ -19,36 +21,29 @@ std::vector<double> MultiplyNaive(const std::vector<double> &a, const std::vecto
       c[(i * n) + j] = sum;
     }
   }
-  return c;
 }
 
-std::vector<double> AddMatr(const std::vector<double> &a, const std::vector<double> &b, int n) {
-  std::vector<double> c(n * n);
+void AddMatr(std::span<const double> a, std::span<const double> b, std::span<double> c, int n) {
   for (int i = 0; i < n * n; ++i) {
     c[i] = a[i] + b[i];
   }
-  return c;
 }
 
-std::vector<double> SubMatr(const std::vector<double> &a, const std::vector<double> &b, int n) {
-  std::vector<double> c(n * n);
+void SubMatr(std::span<const double> a, std::span<const double> b, std::span<double> c, int n) {
   for (int i = 0; i < n * n; ++i) {
     c[i] = a[i] - b[i];
   }
-  return c;
 }
 
-std::vector<double> SubMatrix(const std::vector<double> &m, int n, int row, int col, int size) {
-  std::vector<double> sub(size * size);
+void SubMatrix(std::span<const double> m, std::span<double> sub, int n, int row, int col, int size) {
   for (int i = 0; i < size; ++i) {
     for (int j = 0; j < size; ++j) {
       sub[(i * size) + j] = m[((row + i) * n) + (col + j)];
     }
   }
-  return sub;
 }
 
-void SetSubMatrix(std::vector<double> &m, const std::vector<double> &sub, int n, int row, int col, int size) {
+void SetSubMatrix(std::span<double> m, std::span<const double> sub, int n, int row, int col, int size) {
   for (int i = 0; i < size; ++i) {
     for (int j = 0; j < size; ++j) {
       m[((row + i) * n) + (col + j)] = sub[(i * size) + j];
@@ -56,42 +51,79 @@ void SetSubMatrix(std::vector<double> &m, const std::vector<double> &sub, int n,
   }
 }
 
-std::vector<double> StrassenRecursive(const std::vector<double> &a, const std::vector<double> &b, int n) {
+// Temporaries of every level are taken from arena of thread and released when level returns
+void StrassenRecursive(std::span<const double> a, std::span<const double> b, std::span<double> c, int n) {
   if (n <= 16) {
-    return MultiplyNaive(a, b, n);
+    MultiplyNaive(a, b, c, n);
+    return;
   }
   int k = n / 2;
-  auto a11 = SubMatrix(a, n, 0, 0, k);
-  auto a12 = SubMatrix(a, n, 0, k, k);
-  auto a21 = SubMatrix(a, n, k, 0, k);
-  auto a22 = SubMatrix(a, n, k, k, k);
-
-  auto b11 = SubMatrix(b, n, 0, 0, k);
-  auto b12 = SubMatrix(b, n, 0, k, k);
-  auto b21 = SubMatrix(b, n, k, 0, k);
-  auto b22 = SubMatrix(b, n, k, k, k);
-
-  auto m1 = StrassenRecursive(AddMatr(a11, a22, k), AddMatr(b11, b22, k), k);
-  auto m2 = StrassenRecursive(AddMatr(a21, a22, k), b11, k);
-  auto m3 = StrassenRecursive(a11, SubMatr(b12, b22, k), k);
-  auto m4 = StrassenRecursive(a22, SubMatr(b21, b11, k), k);
-  auto m5 = StrassenRecursive(AddMatr(a11, a12, k), b22, k);
-  auto m6 = StrassenRecursive(SubMatr(a21, a11, k), AddMatr(b11, b12, k), k);
-  auto m7 = StrassenRecursive(SubMatr(a12, a22, k), AddMatr(b21, b22, k), k);
-
-  std::vector<double> c(n * n, 0.0);
-
-  auto c11 = AddMatr(SubMatr(AddMatr(m1, m4, k), m5, k), m7, k);
-  auto c12 = AddMatr(m3, m5, k);
-  auto c21 = AddMatr(m2, m4, k);
-  auto c22 = AddMatr(AddMatr(SubMatr(m1, m2, k), m3, k), m6, k);
-
-  SetSubMatrix(c, c11, n, 0, 0, k);
-  SetSubMatrix(c, c12, n, 0, k, k);
-  SetSubMatrix(c, c21, n, k, 0, k);
-  SetSubMatrix(c, c22, n, k, k, k);
-
-  return c;
+  size_t quarter = static_cast<size_t>(k) * k;
+  auto &arena = ppc::util::ScratchArena::ThreadLocal();
+  ppc::util::ScratchArena::Scope scope(arena);
+
+  auto a11 = arena.Allocate<double>(quarter);
+  auto a12 = arena.Allocate<double>(quarter);
+  auto a21 = arena.Allocate<double>(quarter);
+  auto a22 = arena.Allocate<double>(quarter);
+  SubMatrix(a, a11, n, 0, 0, k);
+  SubMatrix(a, a12, n, 0, k, k);
+  SubMatrix(a, a21, n, k, 0, k);
+  SubMatrix(a, a22, n, k, k, k);
+
+  auto b11 = arena.Allocate<double>(quarter);
+  auto b12 = arena.Allocate<double>(quarter);
+  auto b21 = arena.Allocate<double>(quarter);
+  auto b22 = arena.Allocate<double>(quarter);
+  SubMatrix(b, b11, n, 0, 0, k);
+  SubMatrix(b, b12, n, 0, k, k);
+  SubMatrix(b, b21, n, k, 0, k);
+  SubMatrix(b, b22, n, k, k, k);
+
+  auto lhs = arena.Allocate<double>(quarter);
+  auto rhs = arena.Allocate<double>(quarter);
+  auto m1 = arena.Allocate<double>(quarter);
+  auto m2 = arena.Allocate<double>(quarter);
+  auto m3 = arena.Allocate<double>(quarter);
+  auto m4 = arena.Allocate<double>(quarter);
+  auto m5 = arena.Allocate<double>(quarter);
+  auto m6 = arena.Allocate<double>(quarter);
+  auto m7 = arena.Allocate<double>(quarter);
+
+  AddMatr(a11, a22, lhs, k);
+  AddMatr(b11, b22, rhs, k);
+  StrassenRecursive(lhs, rhs, m1, k);
+  AddMatr(a21, a22, lhs, k);
+  StrassenRecursive(lhs, b11, m2, k);
+  SubMatr(b12, b22, rhs, k);
+  StrassenRecursive(a11, rhs, m3, k);
+  SubMatr(b21, b11, rhs, k);
+  StrassenRecursive(a22, rhs, m4, k);
+  AddMatr(a11, a12, lhs, k);
+  StrassenRecursive(lhs, b22, m5, k);
+  SubMatr(a21, a11, lhs, k);
+  AddMatr(b11, b12, rhs, k);
+  StrassenRecursive(lhs, rhs, m6, k);
+  SubMatr(a12, a22, lhs, k);
+  AddMatr(b21, b22, rhs, k);
+  StrassenRecursive(lhs, rhs, m7, k);
+
+  // c11 = m1 + m4 - m5 + m7
+  AddMatr(m1, m4, lhs, k);
+  SubMatr(lhs, m5, lhs, k);
+  AddMatr(lhs, m7, lhs, k);
+  SetSubMatrix(c, lhs, n, 0, 0, k);
+  // c12 = m3 + m5
+  AddMatr(m3, m5, lhs, k);
+  SetSubMatrix(c, lhs, n, 0, k, k);
+  // c21 = m2 + m4
+  AddMatr(m2, m4, lhs, k);
+  SetSubMatrix(c, lhs, n, k, 0, k);
+  // c22 = m1 - m2 + m3 + m6
+  SubMatr(m1, m2, lhs, k);
+  AddMatr(lhs, m3, lhs, k);
+  AddMatr(lhs, m6, lhs, k);
+  SetSubMatrix(c, lhs, n, k, k, k);
 }
 
 int NextPowerOfTwo(int n) {
@@ -164,7 +196,8 @@ bool SequentialStrassenSeq::RunImpl() {
     }
   }
 
-  auto c_exp = StrassenRecursive(a_exp, b_exp, m);
+  std::vector<double> c_exp(m * m);
+  StrassenRecursive(a_exp, b_exp, c_exp, m);
 
   std::vector<double> c(rowsA_ * colsB_, 0.0);
   for (int i = 0; i < rowsA_; ++i) {
@@ -15,6 +15,7 @@ class RadixSequential : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  [[nodiscard]] ppc::core::WorkEstimate EstimateWork() const override;
 
   static std::array<int, 256> ComputeFrequency(const std::vector<int>& a, int shift);
   static std::array<int, 256> ComputeIndices(const std::array<int, 256>& count);
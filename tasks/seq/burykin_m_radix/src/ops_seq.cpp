@@ -69,6 +69,14 @@ bool burykin_m_radix_seq::RadixSequential::RunImpl() {
   return true;
 }
 
+ppc::core::WorkEstimate burykin_m_radix_seq::RadixSequential::EstimateWork() const {
+  // Element operations instead of flops: each of 4 byte passes counts and moves every element,
+  // reading array twice and writing it once
+  constexpr double kPasses = 4.0;
+  auto count = static_cast<double>(task_data->inputs_count[0]);
+  return {.flops = kPasses * 2.0 * count, .bytes = kPasses * 3.0 * count * sizeof(int)};
+}
+
 bool burykin_m_radix_seq::RadixSequential::PostProcessingImpl() {
   for (size_t i = 0; i < output_.size(); ++i) {
     reinterpret_cast<int*>(task_data->outputs[0])[i] = output_[i];
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -23,11 +24,10 @@ class StrassenAlgSeq : public ppc::core::Task {
   int TRIVIAL_MULTIPLICATION_BOUND_ = 32;
   int extend_ = 0;
 
-  static void TrivialMultiply(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c,
-                              int size);
-  void StrassenMultiply(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c, int size);
-  static void AddMatrix(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c, int size);
-  static void SubMatrix(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c, int size);
+  static void TrivialMultiply(std::span<const double> a, std::span<const double> b, std::span<double> c, int size);
+  void StrassenMultiply(std::span<const double> a, std::span<const double> b, std::span<double> c, int size);
+  static void AddMatrix(std::span<const double> a, std::span<const double> b, std::span<double> c, int size);
+  static void SubMatrix(std::span<const double> a, std::span<const double> b, std::span<double> c, int size);
 };
 
 }  // namespace gnitienko_k_strassen_algorithm
\ No newline at end of file
@@ -2,9 +2,12 @@
 
 #include <cmath>
 #include <cstddef>
+#include <span>
 #include <utility>
 #include <vector>
 
+#include "core/util/include/scratch_arena.hpp"
+
 bool gnitienko_k_strassen_algorithm::StrassenAlgSeq::PreProcessingImpl() {
   size_t input_size = task_data->inputs_count[0];
   auto* in_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
@@ -44,25 +47,23 @@ bool gnitienko_k_strassen_algorithm::StrassenAlgSeq::ValidationImpl() {
   return task_data->inputs_count[0] == task_data->outputs_count[0];
 }
 
-void gnitienko_k_strassen_algorithm::StrassenAlgSeq::AddMatrix(const std::vector<double>& a,
-                                                               const std::vector<double>& b, std::vector<double>& c,
-                                                               int size) {
+void gnitienko_k_strassen_algorithm::StrassenAlgSeq::AddMatrix(std::span<const double> a, std::span<const double> b,
+                                                               std::span<double> c, int size) {
   for (int i = 0; i < size * size; ++i) {
     c[i] = a[i] + b[i];
   }
 }
 
-void gnitienko_k_strassen_algorithm::StrassenAlgSeq::SubMatrix(const std::vector<double>& a,
-                                                               const std::vector<double>& b, std::vector<double>& c,
-                                                               int size) {
+void gnitienko_k_strassen_algorithm::StrassenAlgSeq::SubMatrix(std::span<const double> a, std::span<const double> b,
+                                                               std::span<double> c, int size) {
   for (int i = 0; i < size * size; ++i) {
     c[i] = a[i] - b[i];
   }
 }
 
-void gnitienko_k_strassen_algorithm::StrassenAlgSeq::TrivialMultiply(const std::vector<double>& a,
-                                                                     const std::vector<double>& b,
-                                                                     std::vector<double>& c, int size) {
+void gnitienko_k_strassen_algorithm::StrassenAlgSeq::TrivialMultiply(std::span<const double> a,
+                                                                     std::span<const double> b, std::span<double> c,
+                                                                     int size) {
   for (int i = 0; i < size; ++i) {
     for (int j = 0; j < size; ++j) {
       c[(i * size) + j] = 0;
@@ -73,24 +74,29 @@ void gnitienko_k_strassen_algorithm::StrassenAlgSeq::TrivialMultiply(const std::
   }
 }
 
-void gnitienko_k_strassen_algorithm::StrassenAlgSeq::StrassenMultiply(const std::vector<double>& a,
-                                                                      const std::vector<double>& b,
-                                                                      std::vector<double>& c, int size) {
+void gnitienko_k_strassen_algorithm::StrassenAlgSeq::StrassenMultiply(std::span<const double> a,
+                                                                      std::span<const double> b, std::span<double> c,
+                                                                      int size) {
   if (size <= TRIVIAL_MULTIPLICATION_BOUND_) {
     TrivialMultiply(a, b, c, size);
     return;
   }
 
   int half_size = size / 2;
+  size_t quarter = static_cast<size_t>(half_size) * half_size;
+
+  // Temporaries of this level are returned to arena of thread when recursion returns
+  auto& arena = ppc::util::ScratchArena::ThreadLocal();
+  ppc::util::ScratchArena::Scope scope(arena);
 
-  std::vector<double> a11(half_size * half_size);
-  std::vector<double> a12(half_size * half_size);
-  std::vector<double> a21(half_size * half_size);
-  std::vector<double> a22(half_size * half_size);
-  std::vector<double> b11(half_size * half_size);
-  std::vector<double> b12(half_size * half_size);
-  std::vector<double> b21(half_size * half_size);
-  std::vector<double> b22(half_size * half_size);
+  auto a11 = arena.Allocate<double>(quarter);
+  auto a12 = arena.Allocate<double>(quarter);
+  auto a21 = arena.Allocate<double>(quarter);
+  auto a22 = arena.Allocate<double>(quarter);
+  auto b11 = arena.Allocate<double>(quarter);
+  auto b12 = arena.Allocate<double>(quarter);
+  auto b21 = arena.Allocate<double>(quarter);
+  auto b22 = arena.Allocate<double>(quarter);
 
   for (int i = 0; i < half_size; ++i) {
     for (int j = 0; j < half_size; ++j) {
@@ -110,17 +116,17 @@ void gnitienko_k_strassen_algorithm::StrassenAlgSeq::StrassenMultiply(const std:
     }
   }
 
-  std::vector<double> d(half_size * half_size);
-  std::vector<double> d1(half_size * half_size);
-  std::vector<double> d2(half_size * half_size);
-  std::vector<double> h1(half_size * half_size);
-  std::vector<double> h2(half_size * half_size);
-  std::vector<double> v1(half_size * half_size);
-  std::vector<double> v2(half_size * half_size);
+  auto d = arena.Allocate<double>(quarter);
+  auto d1 = arena.Allocate<double>(quarter);
+  auto d2 = arena.Allocate<double>(quarter);
+  auto h1 = arena.Allocate<double>(quarter);
+  auto h2 = arena.Allocate<double>(quarter);
+  auto v1 = arena.Allocate<double>(quarter);
+  auto v2 = arena.Allocate<double>(quarter);
 
   // d = (a11 + a22) * (b11 + b22)
-  std::vector<double> temp_a(half_size * half_size);
-  std::vector<double> temp_b(half_size * half_size);
+  auto temp_a = arena.Allocate<double>(quarter);
+  auto temp_b = arena.Allocate<double>(quarter);
 
   AddMatrix(a11, a22, temp_a, half_size);
   AddMatrix(b11, b22, temp_b, half_size);
@@ -152,10 +158,10 @@ void gnitienko_k_strassen_algorithm::StrassenAlgSeq::StrassenMultiply(const std:
   SubMatrix(b12, b22, temp_b, half_size);
   StrassenMultiply(a11, temp_b, v2, half_size);
 
-  std::vector<double> c11(half_size * half_size);
-  std::vector<double> c12(half_size * half_size);
-  std::vector<double> c21(half_size * half_size);
-  std::vector<double> c22(half_size * half_size);
+  auto c11 = arena.Allocate<double>(quarter);
+  auto c12 = arena.Allocate<double>(quarter);
+  auto c21 = arena.Allocate<double>(quarter);
+  auto c22 = arena.Allocate<double>(quarter);
 
   AddMatrix(d, d1, c11, half_size);
   AddMatrix(c11, v1, c11, half_size);
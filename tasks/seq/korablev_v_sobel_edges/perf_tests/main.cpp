@@ -8,6 +8,7 @@
 #include <random>
 #include <vector>
 
+#include "core/perf/include/output_digest.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/korablev_v_sobel_edges/include/ops_seq.hpp"
@@ -16,8 +17,7 @@ const std::size_t kHeight = 15'000;
 const std::size_t kWidth = 1'000;
 
 TEST(korablev_v_sobel_edges_seq, test_pipeline_run) {
-  std::random_device dev;
-  std::mt19937 gen(dev());
+  std::mt19937 gen(ppc::core::GetPerfSeed());
   std::uniform_int_distribution<> dist(0, 255);
 
   std::vector<uint8_t> in(kWidth * kHeight * 3);
@@ -37,6 +37,7 @@ TEST(korablev_v_sobel_edges_seq, test_pipeline_run) {
   // Create Perf attributes
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
+  perf_attr->output_digest = [&] { return ppc::core::DigestValues(out); };
   const auto t0 = std::chrono::high_resolution_clock::now();
   perf_attr->current_timer = [&] {
     auto current_time_point = std::chrono::high_resolution_clock::now();
@@ -54,8 +55,7 @@ TEST(korablev_v_sobel_edges_seq, test_pipeline_run) {
 }
 
 TEST(korablev_v_sobel_edges_seq, test_task_run) {
-  std::random_device dev;
-  std::mt19937 gen(dev());
+  std::mt19937 gen(ppc::core::GetPerfSeed());
   std::uniform_int_distribution<> dist(0, 255);
 
   std::vector<uint8_t> in(kWidth * kHeight * 3);
@@ -75,6 +75,7 @@ TEST(korablev_v_sobel_edges_seq, test_task_run) {
   // Create Perf attributes
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
+  perf_attr->output_digest = [&] { return ppc::core::DigestValues(out); };
   const auto t0 = std::chrono::high_resolution_clock::now();
   perf_attr->current_timer = [&] {
     auto current_time_point = std::chrono::high_resolution_clock::now();
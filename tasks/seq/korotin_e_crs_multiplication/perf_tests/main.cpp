@@ -1,54 +1,56 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <vector>
 
+#include "core/gen/include/gen.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/korotin_e_crs_multiplication/include/ops_seq.hpp"
 
-TEST(korotin_e_crs_multiplication_seq, test_pipeline_run) {
-  const unsigned int n = 900;
-
-  std::vector<double> a_val(n * n, 1);
-  std::vector<double> b_val(n * n, 1);
-  std::vector<double> c_val(n * n, n);
-  std::vector<unsigned int> a_ri(n + 1, 0);
-  std::vector<unsigned int> a_col(n * n);
-  std::vector<unsigned int> b_ri(n + 1, 0);
-  std::vector<unsigned int> b_col(n * n);
-  std::vector<unsigned int> c_ri(n + 1, 0);
-  std::vector<unsigned int> c_col(n * n);
+namespace {
 
-  for (unsigned int i = 0; i < n; i++) {
-    for (unsigned int j = 0; j < n; j++) {
-      a_col[(i * n) + j] = j;
-      b_col[(i * n) + j] = j;
-      c_col[(i * n) + j] = j;
+std::vector<double> MultiplyByVector(const std::vector<unsigned int> &r_i, const std::vector<unsigned int> &col,
+                                     const std::vector<double> &val, const std::vector<double> &x) {
+  std::vector<double> y(r_i.size() - 1, 0.0);
+  for (size_t i = 0; i + 1 < r_i.size(); i++) {
+    for (unsigned int k = r_i[i]; k < r_i[i + 1]; k++) {
+      y[i] += val[k] * x[col[k]];
     }
-    a_ri[i + 1] = n * (i + 1);
-    b_ri[i + 1] = n * (i + 1);
-    c_ri[i + 1] = n * (i + 1);
   }
+  return y;
+}
+
+}  // namespace
+
+TEST(korotin_e_crs_multiplication_seq, test_pipeline_run) {
+  const unsigned int n = 900;
+
+  const uint64_t seed = ppc::core::GetPerfSeed();
+  // Dense matrices in CRS form, product takes several seconds on slow machines: raise the budget by PPC_PERF_MAX_TIME
+  // or run with PPC_TIME_LIMIT_MODE=record instead of shrinking the workload
+  auto a = ppc::gen::RandomCsr<double, unsigned int>(n, n, 1.0, -1.0, 1.0, seed);
+  auto b = ppc::gen::RandomCsr<double, unsigned int>(n, n, 1.0, -1.0, 1.0, seed + 1);
 
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a_ri.data()));
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a_col.data()));
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a_val.data()));
-  task_data_seq->inputs_count.emplace_back(a_ri.size());
-  task_data_seq->inputs_count.emplace_back(a_col.size());
-  task_data_seq->inputs_count.emplace_back(a_val.size());
-
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b_ri.data()));
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b_col.data()));
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b_val.data()));
-  task_data_seq->inputs_count.emplace_back(b_ri.size());
-  task_data_seq->inputs_count.emplace_back(b_col.size());
-  task_data_seq->inputs_count.emplace_back(b_val.size());
-
-  std::vector<unsigned int> out_ri(a_ri.size(), 0);
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.row_ptr.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.col_idx.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.values.data()));
+  task_data_seq->inputs_count.emplace_back(a.row_ptr.size());
+  task_data_seq->inputs_count.emplace_back(a.col_idx.size());
+  task_data_seq->inputs_count.emplace_back(a.values.size());
+
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.row_ptr.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.col_idx.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.values.data()));
+  task_data_seq->inputs_count.emplace_back(b.row_ptr.size());
+  task_data_seq->inputs_count.emplace_back(b.col_idx.size());
+  task_data_seq->inputs_count.emplace_back(b.values.size());
+
+  std::vector<unsigned int> out_ri(a.row_ptr.size(), 0);
   std::vector<unsigned int> out_col(n * n);
   std::vector<double> out_val(n * n);
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_ri.data()));
@@ -78,51 +80,38 @@ TEST(korotin_e_crs_multiplication_seq, test_pipeline_run) {
   perf_analyzer->PipelineRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
 
-  ASSERT_EQ(c_ri, out_ri);
-  ASSERT_EQ(c_col, out_col);
-  ASSERT_EQ(c_val, out_val);
+  // (A * B) * x == A * (B * x) for random x checks product in O(nonzeros)
+  auto x = ppc::gen::UniformVector<double>(n, -1.0, 1.0, seed, 2);
+  auto expected = MultiplyByVector(a.row_ptr, a.col_idx, a.values, MultiplyByVector(b.row_ptr, b.col_idx, b.values, x));
+  auto actual = MultiplyByVector(out_ri, out_col, out_val, x);
+  for (unsigned int i = 0; i < n; i++) {
+    ASSERT_NEAR(actual[i], expected[i], 1e-9);
+  }
 }
 
 TEST(korotin_e_crs_multiplication_seq, test_task_run) {
   const unsigned int n = 900;
 
-  std::vector<double> a_val(n * n, 1);
-  std::vector<double> b_val(n * n, 1);
-  std::vector<double> c_val(n * n, n);
-  std::vector<unsigned int> a_ri(n + 1, 0);
-  std::vector<unsigned int> a_col(n * n);
-  std::vector<unsigned int> b_ri(n + 1, 0);
-  std::vector<unsigned int> b_col(n * n);
-  std::vector<unsigned int> c_ri(n + 1, 0);
-  std::vector<unsigned int> c_col(n * n);
-
-  for (unsigned int i = 0; i < n; i++) {
-    for (unsigned int j = 0; j < n; j++) {
-      a_col[(i * n) + j] = j;
-      b_col[(i * n) + j] = j;
-      c_col[(i * n) + j] = j;
-    }
-    a_ri[i + 1] = n * (i + 1);
-    b_ri[i + 1] = n * (i + 1);
-    c_ri[i + 1] = n * (i + 1);
-  }
+  const uint64_t seed = ppc::core::GetPerfSeed();
+  auto a = ppc::gen::RandomCsr<double, unsigned int>(n, n, 1.0, -1.0, 1.0, seed);
+  auto b = ppc::gen::RandomCsr<double, unsigned int>(n, n, 1.0, -1.0, 1.0, seed + 1);
 
   auto task_data_seq = std::make_shared<ppc::core::TaskData>();
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a_ri.data()));
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a_col.data()));
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a_val.data()));
-  task_data_seq->inputs_count.emplace_back(a_ri.size());
-  task_data_seq->inputs_count.emplace_back(a_col.size());
-  task_data_seq->inputs_count.emplace_back(a_val.size());
-
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b_ri.data()));
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b_col.data()));
-  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b_val.data()));
-  task_data_seq->inputs_count.emplace_back(b_ri.size());
-  task_data_seq->inputs_count.emplace_back(b_col.size());
-  task_data_seq->inputs_count.emplace_back(b_val.size());
-
-  std::vector<unsigned int> out_ri(a_ri.size(), 0);
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.row_ptr.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.col_idx.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.values.data()));
+  task_data_seq->inputs_count.emplace_back(a.row_ptr.size());
+  task_data_seq->inputs_count.emplace_back(a.col_idx.size());
+  task_data_seq->inputs_count.emplace_back(a.values.size());
+
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.row_ptr.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.col_idx.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.values.data()));
+  task_data_seq->inputs_count.emplace_back(b.row_ptr.size());
+  task_data_seq->inputs_count.emplace_back(b.col_idx.size());
+  task_data_seq->inputs_count.emplace_back(b.values.size());
+
+  std::vector<unsigned int> out_ri(a.row_ptr.size(), 0);
   std::vector<unsigned int> out_col(n * n);
   std::vector<double> out_val(n * n);
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_ri.data()));
@@ -152,7 +141,11 @@ TEST(korotin_e_crs_multiplication_seq, test_task_run) {
   perf_analyzer->TaskRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
 
-  ASSERT_EQ(c_ri, out_ri);
-  ASSERT_EQ(c_col, out_col);
-  ASSERT_EQ(c_val, out_val);
+  // (A * B) * x == A * (B * x) for random x checks product in O(nonzeros)
+  auto x = ppc::gen::UniformVector<double>(n, -1.0, 1.0, seed, 2);
+  auto expected = MultiplyByVector(a.row_ptr, a.col_idx, a.values, MultiplyByVector(b.row_ptr, b.col_idx, b.values, x));
+  auto actual = MultiplyByVector(out_ri, out_col, out_val, x);
+  for (unsigned int i = 0; i < n; i++) {
+    ASSERT_NEAR(actual[i], expected[i], 1e-9);
+  }
 }
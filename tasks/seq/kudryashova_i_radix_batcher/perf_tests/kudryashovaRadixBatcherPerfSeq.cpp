@@ -2,23 +2,17 @@
 
 #include <chrono>
 #include <cstdint>
-#include <ctime>
 #include <memory>
-#include <random>
 #include <vector>
 
+#include "core/gen/include/gen.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/kudryashova_i_radix_batcher/include/kudryashovaRadixBatcherSeq.hpp"
 
 std::vector<double> kudryashova_i_radix_batcher_seq::GetRandomDoubleVector(int size) {
-  std::vector<double> vector(size);
-  std::mt19937 generator(static_cast<unsigned>(std::time(nullptr)));
-  std::uniform_real_distribution<double> distribution(-1000.0, 1000.0);
-  for (int i = 0; i < size; ++i) {
-    vector[i] = distribution(generator);
-  }
-  return vector;
+  // Counter-based generator fills the vector in parallel, PPC_PERF_SEED reproduces the input
+  return ppc::gen::UniformVector<double>(size, -1000.0, 1000.0, ppc::core::GetPerfSeed());
 }
 
 TEST(kudryashova_i_radix_batcher_seq, test_pipeline_run) {
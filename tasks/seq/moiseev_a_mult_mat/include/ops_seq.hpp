@@ -1,9 +1,9 @@
 #pragma once
 
 #include <utility>
-#include <vector>
 
 #include "core/task/include/task.hpp"
+#include "core/util/include/aligned_allocator.hpp"
 
 namespace moiseev_a_mult_mat_seq {
 
@@ -14,9 +14,10 @@ class MultMatSequential : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  [[nodiscard]] ppc::core::WorkEstimate EstimateWork() const override;
 
  private:
-  std::vector<double> matrix_a_, matrix_b_, matrix_c_;
+  ppc::util::Buffer<double> matrix_a_, matrix_b_, matrix_c_;
   int matrix_size_{};
   int num_blocks_{};
   int block_size_{};
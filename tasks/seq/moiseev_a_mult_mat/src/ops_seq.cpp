@@ -2,7 +2,6 @@
 
 #include <algorithm>
 #include <cmath>
-#include <vector>
 
 bool moiseev_a_mult_mat_seq::MultMatSequential::PreProcessingImpl() {
   unsigned int input_size_a = task_data->inputs_count[0];
@@ -11,11 +10,11 @@ bool moiseev_a_mult_mat_seq::MultMatSequential::PreProcessingImpl() {
   auto *in_ptr_a = reinterpret_cast<double *>(task_data->inputs[0]);
   auto *in_ptr_b = reinterpret_cast<double *>(task_data->inputs[1]);
 
-  matrix_a_ = std::vector<double>(in_ptr_a, in_ptr_a + input_size_a);
-  matrix_b_ = std::vector<double>(in_ptr_b, in_ptr_b + input_size_b);
+  matrix_a_.assign(in_ptr_a, in_ptr_a + input_size_a);
+  matrix_b_.assign(in_ptr_b, in_ptr_b + input_size_b);
 
   unsigned int output_size = task_data->outputs_count[0];
-  matrix_c_ = std::vector<double>(output_size, 0.0);
+  matrix_c_.assign(output_size, 0.0);
 
   matrix_size_ = static_cast<int>(std::sqrt(input_size_a));
 
@@ -65,6 +64,12 @@ bool moiseev_a_mult_mat_seq::MultMatSequential::RunImpl() {
   return true;
 }
 
+ppc::core::WorkEstimate moiseev_a_mult_mat_seq::MultMatSequential::EstimateWork() const {
+  // Multiply-add per inner step, each of A, B and C passes through memory at least once
+  auto n = std::sqrt(static_cast<double>(task_data->inputs_count[0]));
+  return {.flops = 2.0 * n * n * n, .bytes = 3.0 * n * n * sizeof(double)};
+}
+
 bool moiseev_a_mult_mat_seq::MultMatSequential::PostProcessingImpl() {
   auto *out_ptr = reinterpret_cast<double *>(task_data->outputs[0]);
   std::ranges::copy(matrix_c_, out_ptr);
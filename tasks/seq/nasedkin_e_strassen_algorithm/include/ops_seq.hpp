@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -18,16 +19,16 @@ class StrassenSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  static std::vector<double> AddMatrices(const std::vector<double>& a, const std::vector<double>& b, int size);
-  static std::vector<double> SubtractMatrices(const std::vector<double>& a, const std::vector<double>& b, int size);
-  static void SplitMatrix(const std::vector<double>& parent, std::vector<double>& child, int row_start, int col_start,
+  static void AddMatrices(std::span<const double> a, std::span<const double> b, std::span<double> c);
+  static void SubtractMatrices(std::span<const double> a, std::span<const double> b, std::span<double> c);
+  static void SplitMatrix(std::span<const double> parent, std::span<double> child, int row_start, int col_start,
                           int parent_size);
-  static void MergeMatrix(std::vector<double>& parent, const std::vector<double>& child, int row_start, int col_start,
+  static void MergeMatrix(std::span<double> parent, std::span<const double> child, int row_start, int col_start,
                           int parent_size);
   static std::vector<double> PadMatrixToPowerOfTwo(const std::vector<double>& matrix, int original_size);
   static std::vector<double> TrimMatrixToOriginalSize(const std::vector<double>& matrix, int original_size,
                                                       int padded_size);
-  static std::vector<double> StrassenMultiply(const std::vector<double>& a, const std::vector<double>& b, int size);
+  static void StrassenMultiply(std::span<const double> a, std::span<const double> b, std::span<double> c, int size);
 
   std::vector<double> input_matrix_a_, input_matrix_b_;
   std::vector<double> output_matrix_;
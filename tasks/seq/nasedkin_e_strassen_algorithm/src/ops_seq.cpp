@@ -2,9 +2,28 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <functional>
+#include <span>
 #include <vector>
 
+#include "core/util/include/scratch_arena.hpp"
+
+namespace {
+
+void MultiplyInto(std::span<const double> a, std::span<const double> b, std::span<double> c, int size) {
+  std::ranges::fill(c, 0.0);
+  for (int i = 0; i < size; ++i) {
+    for (int j = 0; j < size; ++j) {
+      for (int k = 0; k < size; ++k) {
+        c[(i * size) + j] += a[(i * size) + k] * b[(k * size) + j];
+      }
+    }
+  }
+}
+
+}  // namespace
+
 bool nasedkin_e_strassen_algorithm_seq::StrassenSequential::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   auto* in_ptr_a = reinterpret_cast<double*>(task_data->inputs[0]);
@@ -43,7 +62,7 @@ bool nasedkin_e_strassen_algorithm_seq::StrassenSequential::ValidationImpl() {
 }
 
 bool nasedkin_e_strassen_algorithm_seq::StrassenSequential::RunImpl() {
-  output_matrix_ = StrassenMultiply(input_matrix_a_, input_matrix_b_, matrix_size_);
+  StrassenMultiply(input_matrix_a_, input_matrix_b_, output_matrix_, matrix_size_);
   return true;
 }
 
@@ -57,31 +76,22 @@ bool nasedkin_e_strassen_algorithm_seq::StrassenSequential::PostProcessingImpl()
   return true;
 }
 
-std::vector<double> nasedkin_e_strassen_algorithm_seq::StrassenSequential::AddMatrices(const std::vector<double>& a,
-                                                                                       const std::vector<double>& b,
-                                                                                       int size) {
-  std::vector<double> result(size * size);
-  std::ranges::transform(a, b, result.begin(), std::plus<>());
-  return result;
+void nasedkin_e_strassen_algorithm_seq::StrassenSequential::AddMatrices(std::span<const double> a,
+                                                                        std::span<const double> b,
+                                                                        std::span<double> c) {
+  std::ranges::transform(a, b, c.begin(), std::plus<>());
 }
 
-std::vector<double> nasedkin_e_strassen_algorithm_seq::StrassenSequential::SubtractMatrices(
-    const std::vector<double>& a, const std::vector<double>& b, int size) {
-  std::vector<double> result(size * size);
-  std::ranges::transform(a, b, result.begin(), std::minus<>());
-  return result;
+void nasedkin_e_strassen_algorithm_seq::StrassenSequential::SubtractMatrices(std::span<const double> a,
+                                                                             std::span<const double> b,
+                                                                             std::span<double> c) {
+  std::ranges::transform(a, b, c.begin(), std::minus<>());
 }
 
 std::vector<double> nasedkin_e_strassen_algorithm_seq::StandardMultiply(const std::vector<double>& a,
                                                                         const std::vector<double>& b, int size) {
-  std::vector<double> result(size * size, 0.0);
-  for (int i = 0; i < size; ++i) {
-    for (int j = 0; j < size; ++j) {
-      for (int k = 0; k < size; ++k) {
-        result[(i * size) + j] += a[(i * size) + k] * b[(k * size) + j];
-      }
-    }
-  }
+  std::vector<double> result(size * size);
+  MultiplyInto(a, b, result, size);
   return result;
 }
 
@@ -110,22 +120,30 @@ std::vector<double> nasedkin_e_strassen_algorithm_seq::StrassenSequential::TrimM
   return trimmed_matrix;
 }
 
-std::vector<double> nasedkin_e_strassen_algorithm_seq::StrassenSequential::StrassenMultiply(
-    const std::vector<double>& a, const std::vector<double>& b, int size) {
+void nasedkin_e_strassen_algorithm_seq::StrassenSequential::StrassenMultiply(std::span<const double> a,
+                                                                             std::span<const double> b,
+                                                                             std::span<double> c, int size) {
   if (size <= 32) {
-    return StandardMultiply(a, b, size);
+    MultiplyInto(a, b, c, size);
+    return;
   }
 
   int half_size = size / 2;
-  std::vector<double> a11(half_size * half_size);
-  std::vector<double> a12(half_size * half_size);
-  std::vector<double> a21(half_size * half_size);
-  std::vector<double> a22(half_size * half_size);
+  size_t quarter = static_cast<size_t>(half_size) * half_size;
+
+  // Quadrants, products and sums of this level go back to arena of thread when recursion returns
+  auto& arena = ppc::util::ScratchArena::ThreadLocal();
+  ppc::util::ScratchArena::Scope scope(arena);
 
-  std::vector<double> b11(half_size * half_size);
-  std::vector<double> b12(half_size * half_size);
-  std::vector<double> b21(half_size * half_size);
-  std::vector<double> b22(half_size * half_size);
+  auto a11 = arena.Allocate<double>(quarter);
+  auto a12 = arena.Allocate<double>(quarter);
+  auto a21 = arena.Allocate<double>(quarter);
+  auto a22 = arena.Allocate<double>(quarter);
+
+  auto b11 = arena.Allocate<double>(quarter);
+  auto b12 = arena.Allocate<double>(quarter);
+  auto b21 = arena.Allocate<double>(quarter);
+  auto b22 = arena.Allocate<double>(quarter);
 
   SplitMatrix(a, a11, 0, 0, size);
   SplitMatrix(a, a12, 0, half_size, size);
@@ -137,33 +155,63 @@ std::vector<double> nasedkin_e_strassen_algorithm_seq::StrassenSequential::Stras
   SplitMatrix(b, b21, half_size, 0, size);
   SplitMatrix(b, b22, half_size, half_size, size);
 
-  std::vector<double> p1 =
-      StrassenMultiply(AddMatrices(a11, a22, half_size), AddMatrices(b11, b22, half_size), half_size);
-  std::vector<double> p2 = StrassenMultiply(AddMatrices(a21, a22, half_size), b11, half_size);
-  std::vector<double> p3 = StrassenMultiply(a11, SubtractMatrices(b12, b22, half_size), half_size);
-  std::vector<double> p4 = StrassenMultiply(a22, SubtractMatrices(b21, b11, half_size), half_size);
-  std::vector<double> p5 = StrassenMultiply(AddMatrices(a11, a12, half_size), b22, half_size);
-  std::vector<double> p6 =
-      StrassenMultiply(SubtractMatrices(a21, a11, half_size), AddMatrices(b11, b12, half_size), half_size);
-  std::vector<double> p7 =
-      StrassenMultiply(SubtractMatrices(a12, a22, half_size), AddMatrices(b21, b22, half_size), half_size);
-
-  std::vector<double> c11 = AddMatrices(SubtractMatrices(AddMatrices(p1, p4, half_size), p5, half_size), p7, half_size);
-  std::vector<double> c12 = AddMatrices(p3, p5, half_size);
-  std::vector<double> c21 = AddMatrices(p2, p4, half_size);
-  std::vector<double> c22 = AddMatrices(SubtractMatrices(AddMatrices(p1, p3, half_size), p2, half_size), p6, half_size);
-
-  std::vector<double> result(size * size);
-  MergeMatrix(result, c11, 0, 0, size);
-  MergeMatrix(result, c12, 0, half_size, size);
-  MergeMatrix(result, c21, half_size, 0, size);
-  MergeMatrix(result, c22, half_size, half_size, size);
-
-  return result;
+  auto p1 = arena.Allocate<double>(quarter);
+  auto p2 = arena.Allocate<double>(quarter);
+  auto p3 = arena.Allocate<double>(quarter);
+  auto p4 = arena.Allocate<double>(quarter);
+  auto p5 = arena.Allocate<double>(quarter);
+  auto p6 = arena.Allocate<double>(quarter);
+  auto p7 = arena.Allocate<double>(quarter);
+  auto temp_a = arena.Allocate<double>(quarter);
+  auto temp_b = arena.Allocate<double>(quarter);
+
+  AddMatrices(a11, a22, temp_a);
+  AddMatrices(b11, b22, temp_b);
+  StrassenMultiply(temp_a, temp_b, p1, half_size);
+
+  AddMatrices(a21, a22, temp_a);
+  StrassenMultiply(temp_a, b11, p2, half_size);
+
+  SubtractMatrices(b12, b22, temp_b);
+  StrassenMultiply(a11, temp_b, p3, half_size);
+
+  SubtractMatrices(b21, b11, temp_b);
+  StrassenMultiply(a22, temp_b, p4, half_size);
+
+  AddMatrices(a11, a12, temp_a);
+  StrassenMultiply(temp_a, b22, p5, half_size);
+
+  SubtractMatrices(a21, a11, temp_a);
+  AddMatrices(b11, b12, temp_b);
+  StrassenMultiply(temp_a, temp_b, p6, half_size);
+
+  SubtractMatrices(a12, a22, temp_a);
+  AddMatrices(b21, b22, temp_b);
+  StrassenMultiply(temp_a, temp_b, p7, half_size);
+
+  // c11 = p1 + p4 - p5 + p7, c22 = p1 + p3 - p2 + p6, quadrants are reused as output blocks
+  auto c11 = a11;
+  auto c12 = a12;
+  auto c21 = a21;
+  auto c22 = a22;
+
+  AddMatrices(p1, p4, c11);
+  SubtractMatrices(c11, p5, c11);
+  AddMatrices(c11, p7, c11);
+  AddMatrices(p3, p5, c12);
+  AddMatrices(p2, p4, c21);
+  AddMatrices(p1, p3, c22);
+  SubtractMatrices(c22, p2, c22);
+  AddMatrices(c22, p6, c22);
+
+  MergeMatrix(c, c11, 0, 0, size);
+  MergeMatrix(c, c12, 0, half_size, size);
+  MergeMatrix(c, c21, half_size, 0, size);
+  MergeMatrix(c, c22, half_size, half_size, size);
 }
 
-void nasedkin_e_strassen_algorithm_seq::StrassenSequential::SplitMatrix(const std::vector<double>& parent,
-                                                                        std::vector<double>& child, int row_start,
+void nasedkin_e_strassen_algorithm_seq::StrassenSequential::SplitMatrix(std::span<const double> parent,
+                                                                        std::span<double> child, int row_start,
                                                                         int col_start, int parent_size) {
   int child_size = static_cast<int>(std::sqrt(child.size()));
   for (int i = 0; i < child_size; ++i) {
@@ -173,8 +221,8 @@ void nasedkin_e_strassen_algorithm_seq::StrassenSequential::SplitMatrix(const st
   }
 }
 
-void nasedkin_e_strassen_algorithm_seq::StrassenSequential::MergeMatrix(std::vector<double>& parent,
-                                                                        const std::vector<double>& child, int row_start,
+void nasedkin_e_strassen_algorithm_seq::StrassenSequential::MergeMatrix(std::span<double> parent,
+                                                                        std::span<const double> child, int row_start,
                                                                         int col_start, int parent_size) {
   int child_size = static_cast<int>(std::sqrt(child.size()));
   for (int i = 0; i < child_size; ++i) {
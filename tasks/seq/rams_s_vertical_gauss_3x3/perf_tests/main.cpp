@@ -8,6 +8,7 @@
 #include <memory>
 #include <vector>
 
+#include "core/perf/include/output_digest.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 
@@ -36,6 +37,7 @@ void RunTest(bool pipeline) {
 
   auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
   perf_attr->num_running = 10;
+  perf_attr->output_digest = [&] { return ppc::core::DigestValues(out); };
   const auto t0 = std::chrono::high_resolution_clock::now();
   perf_attr->current_timer = [&] {
     auto current_time_point = std::chrono::high_resolution_clock::now();
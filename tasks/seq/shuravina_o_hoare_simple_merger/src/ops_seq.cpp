@@ -4,6 +4,8 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/util/include/scratch_arena.hpp"
+
 namespace shuravina_o_hoare_simple_merger {
 
 void TestTaskSequential::QuickSort(std::vector<int>& arr, int low, int high) {
@@ -27,7 +29,9 @@ void TestTaskSequential::QuickSort(std::vector<int>& arr, int low, int high) {
 }
 
 void TestTaskSequential::Merge(std::vector<int>& arr, int low, int mid, int high) {
-  std::vector<int> temp(high - low + 1);
+  auto& arena = ppc::util::ScratchArena::ThreadLocal();
+  ppc::util::ScratchArena::Scope scope(arena);
+  auto temp = arena.Allocate<int>(static_cast<size_t>(high - low + 1));
   int i = low;
   int j = mid + 1;
   int k = 0;
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "core/util/include/aligned_allocator.hpp"
 
 namespace titov_s_image_filter_horiz_gaussian3x3_seq {
 
@@ -14,10 +15,11 @@ class ImageFilterSequential : public ppc::core::Task {
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
+  [[nodiscard]] ppc::core::WorkEstimate EstimateWork() const override;
 
  private:
-  std::vector<double> input_;
-  std::vector<double> output_;
+  ppc::util::Buffer<double> input_;
+  ppc::util::Buffer<double> output_;
   int width_;
   int height_;
   int kernel_size_ = 3;
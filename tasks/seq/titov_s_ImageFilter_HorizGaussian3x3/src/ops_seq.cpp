@@ -12,7 +12,7 @@ bool titov_s_image_filter_horiz_gaussian3x3_seq::ImageFilterSequential::PreProce
 
   auto *kernel_ptr = reinterpret_cast<int *>(task_data->inputs[1]);
   kernel_ = std::vector<int>(kernel_ptr, kernel_ptr + 3);
-  output_ = std::vector<double>(input_size, 0.0);
+  output_.assign(input_size, 0.0);
 
   return true;
 }
@@ -47,6 +47,12 @@ bool titov_s_image_filter_horiz_gaussian3x3_seq::ImageFilterSequential::RunImpl(
   return true;
 }
 
+ppc::core::WorkEstimate titov_s_image_filter_horiz_gaussian3x3_seq::ImageFilterSequential::EstimateWork() const {
+  // 3 multiplications, 2 additions and division per pixel, pixel is read and written once
+  auto pixels = static_cast<double>(task_data->inputs_count[0]);
+  return {.flops = 6.0 * pixels, .bytes = 2.0 * pixels * sizeof(double)};
+}
+
 bool titov_s_image_filter_horiz_gaussian3x3_seq::ImageFilterSequential::PostProcessingImpl() {
   auto *out_ptr = reinterpret_cast<double *>(task_data->outputs[0]);
 
@@ -5,10 +5,8 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <thread>
-#include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/util/include/thread_pool.hpp"
 
 // clang-format off
 constexpr int8_t kSobelKernelX[3][3] = {
@@ -52,42 +50,31 @@ bool korablev_v_sobel_edges_stl::TestTask::RunImpl() {  // NOLINT(readability-fu
 
   auto& image = in_.data;
 
-  std::vector<std::thread> threads(ppc::util::GetPPCNumThreads());
-  const std::size_t delta = (height - 2) / threads.size();
-  const std::size_t extra = (height - 2) % threads.size();
+  // Rows are processed by warm workers of shared pool instead of threads created on every run
+  ppc::util::ThreadPool::Global().ParallelForRange(1, height - 1, [&](std::size_t lidx, std::size_t ridx) {
+    for (std::size_t y = lidx; y < ridx; ++y) {
+      for (std::size_t x = 1; x < width - 1; ++x) {
+        std::array<int32_t, 3> sum_x{0};
+        std::array<int32_t, 3> sum_y{0};
 
-  std::size_t pos = 1;
-  for (std::size_t threadnum = 0; threadnum < threads.size(); threadnum++) {
-    const std::size_t dedicated = delta + ((threadnum < extra) ? 1 : 0);
-    threads[threadnum] = std::thread(
-        [&](uint32_t lidx, uint32_t ridx) {
-          for (std::size_t y = lidx; y < ridx; ++y) {
-            for (std::size_t x = 1; x < width - 1; ++x) {
-              std::array<int32_t, 3> sum_x{0};
-              std::array<int32_t, 3> sum_y{0};
-
-              for (int ky = -1; ky <= 1; ++ky) {
-                for (int kx = -1; kx <= 1; ++kx) {
-                  int idx = ((y + ky) * width + (x + kx)) * 3;  // NOLINT(bugprone-narrowing-conversions)
-                  for (int j = 0; j < 3; j++) {
-                    const int32_t pixel_value = image[idx + j];
-                    sum_x[j] += kSobelKernelX[ky + 1][kx + 1] * pixel_value;
-                    sum_y[j] += kSobelKernelY[ky + 1][kx + 1] * pixel_value;
-                  }
-                }
-              }
-
-              for (int i = 0; i < 3; ++i) {
-                out_.data[((y * width + x) * 3) + i] = static_cast<uint8_t>(
-                    std::min(static_cast<int32_t>(std::sqrt((sum_x[i] * sum_x[i]) + (sum_y[i] * sum_y[i]))), 255));
-              }
+        for (int ky = -1; ky <= 1; ++ky) {
+          for (int kx = -1; kx <= 1; ++kx) {
+            int idx = ((y + ky) * width + (x + kx)) * 3;  // NOLINT(bugprone-narrowing-conversions)
+            for (int j = 0; j < 3; j++) {
+              const int32_t pixel_value = image[idx + j];
+              sum_x[j] += kSobelKernelX[ky + 1][kx + 1] * pixel_value;
+              sum_y[j] += kSobelKernelY[ky + 1][kx + 1] * pixel_value;
             }
           }
-        },
-        pos, pos + dedicated);
-    pos += dedicated;
-  }
-  std::ranges::for_each(threads, [](auto& thread) { thread.join(); });
+        }
+
+        for (int i = 0; i < 3; ++i) {
+          out_.data[((y * width + x) * 3) + i] = static_cast<uint8_t>(
+              std::min(static_cast<int32_t>(std::sqrt((sum_x[i] * sum_x[i]) + (sum_y[i] * sum_y[i]))), 255));
+        }
+      }
+    }
+  });
 
   return true;
 }
@@ -1,8 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <utility>
-#include <vector>
 
 #include "core/task/include/task.hpp"
 
@@ -17,9 +17,10 @@ class TaskStl : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  uint32_t height_, width_;
-  std::vector<uint8_t> input_, output_;
-  std::vector<float> kernel_;
+  uint64_t height_, width_;
+  std::span<const uint8_t> input_;
+  std::span<uint8_t> output_;
+  std::span<const float> kernel_;
 };
 
 }  // namespace rams_s_vertical_gauss_3x3_stl
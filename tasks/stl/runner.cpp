@@ -1,6 +1,14 @@
 #include <gtest/gtest.h>
 
+#include "core/util/include/affinity.hpp"
+
 int main(int argc, char **argv) {
+  // Malformed PPC_AFFINITY throws here, before pinning would silently leave threads unpinned
+  if (ppc::util::GetAffinityConfig().policy != ppc::util::AffinityPolicy::kNone) {
+    // Calling thread is the first thread of every parallel loop, workers of thread pool are pinned on start
+    ppc::util::PinCurrentThread(0);
+  }
+
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
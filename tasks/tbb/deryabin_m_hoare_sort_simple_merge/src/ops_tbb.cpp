@@ -8,6 +8,7 @@
 #include <numbers>
 #include <vector>
 
+#include "core/util/include/scratch_arena.hpp"
 #include "oneapi/tbb/parallel_for.h"
 
 void deryabin_m_hoare_sort_simple_merge_tbb::HoaraSort(std::vector<double>& a, size_t first, size_t last) {
@@ -43,8 +44,11 @@ void deryabin_m_hoare_sort_simple_merge_tbb::MergeTwoParts(std::vector<double>&
   size_t middle = (right - left) / 2;
   size_t l_cur = 0;
   size_t r_cur = 0;
-  std::vector<double> l_buff(middle + 1);
-  std::vector<double> r_buff(middle + 1);
+  // Halves are copied to arena of thread that merges this segment
+  auto& arena = ppc::util::ScratchArena::ThreadLocal();
+  ppc::util::ScratchArena::Scope scope(arena);
+  auto l_buff = arena.Allocate<double>(middle + 1);
+  auto r_buff = arena.Allocate<double>(middle + 1);
   std::copy(a.begin() + (long)left, a.begin() + (long)left + (long)middle + 1, l_buff.begin());
   std::copy(a.begin() + (long)left + (long)middle + 1, a.begin() + (long)right + 1, r_buff.begin());
   for (size_t i = left; i <= right; i++) {
@@ -11,83 +11,89 @@
 #include "tbb/example/include/ops_tbb.hpp"
 
 TEST(nesterov_a_test_task_tbb, test_pipeline_run) {
-  constexpr int kCount = 700;
-
-  // Create data
-  std::vector<int> in(kCount * kCount, 0);
-  std::vector<int> out(kCount * kCount, 0);
-
-  for (size_t i = 0; i < kCount; i++) {
-    in[(i * kCount) + i] = 1;
+  constexpr uint64_t kDefaultCount = 700;
+
+  // Matrix size can be changed by PPC_PERF_SIZES to measure task at larger inputs
+  for (auto count : ppc::core::GetPerfSizes(kDefaultCount)) {
+    // Create data
+    std::vector<int> in(count * count, 0);
+    std::vector<int> out(count * count, 0);
+
+    for (size_t i = 0; i < count; i++) {
+      in[(i * count) + i] = 1;
+    }
+
+    // Create task_data
+    auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+    task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+    task_data_tbb->inputs_count.emplace_back(in.size());
+    task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    task_data_tbb->outputs_count.emplace_back(out.size());
+
+    // Create Task
+    auto test_task_tbb = std::make_shared<nesterov_a_test_task_tbb::TestTaskTBB>(task_data_tbb);
+
+    // Create Perf attributes
+    auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+    perf_attr->num_running = 10;
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    perf_attr->current_timer = [&] {
+      auto current_time_point = std::chrono::high_resolution_clock::now();
+      auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+      return static_cast<double>(duration) * 1e-9;
+    };
+
+    // Create and init perf results
+    auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+    // Create Perf analyzer
+    auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_tbb);
+    perf_analyzer->PipelineRun(perf_attr, perf_results);
+    ppc::core::Perf::PrintPerfStatistic(perf_results);
+    ASSERT_EQ(in, out);
   }
-
-  // Create task_data
-  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
-  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_tbb->inputs_count.emplace_back(in.size());
-  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
-  task_data_tbb->outputs_count.emplace_back(out.size());
-
-  // Create Task
-  auto test_task_tbb = std::make_shared<nesterov_a_test_task_tbb::TestTaskTBB>(task_data_tbb);
-
-  // Create Perf attributes
-  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
-  perf_attr->num_running = 10;
-  const auto t0 = std::chrono::high_resolution_clock::now();
-  perf_attr->current_timer = [&] {
-    auto current_time_point = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
-    return static_cast<double>(duration) * 1e-9;
-  };
-
-  // Create and init perf results
-  auto perf_results = std::make_shared<ppc::core::PerfResults>();
-
-  // Create Perf analyzer
-  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_tbb);
-  perf_analyzer->PipelineRun(perf_attr, perf_results);
-  ppc::core::Perf::PrintPerfStatistic(perf_results);
-  ASSERT_EQ(in, out);
 }
 
 TEST(nesterov_a_test_task_tbb, test_task_run) {
-  constexpr int kCount = 700;
-
-  // Create data
-  std::vector<int> in(kCount * kCount, 0);
-  std::vector<int> out(kCount * kCount, 0);
-
-  for (size_t i = 0; i < kCount; i++) {
-    in[(i * kCount) + i] = 1;
+  constexpr uint64_t kDefaultCount = 700;
+
+  // Matrix size can be changed by PPC_PERF_SIZES to measure task at larger inputs
+  for (auto count : ppc::core::GetPerfSizes(kDefaultCount)) {
+    // Create data
+    std::vector<int> in(count * count, 0);
+    std::vector<int> out(count * count, 0);
+
+    for (size_t i = 0; i < count; i++) {
+      in[(i * count) + i] = 1;
+    }
+
+    // Create task_data
+    auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+    task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+    task_data_tbb->inputs_count.emplace_back(in.size());
+    task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    task_data_tbb->outputs_count.emplace_back(out.size());
+
+    // Create Task
+    auto test_task_tbb = std::make_shared<nesterov_a_test_task_tbb::TestTaskTBB>(task_data_tbb);
+
+    // Create Perf attributes
+    auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+    perf_attr->num_running = 10;
+    const auto t0 = std::chrono::high_resolution_clock::now();
+    perf_attr->current_timer = [&] {
+      auto current_time_point = std::chrono::high_resolution_clock::now();
+      auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+      return static_cast<double>(duration) * 1e-9;
+    };
+
+    // Create and init perf results
+    auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+    // Create Perf analyzer
+    auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_tbb);
+    perf_analyzer->TaskRun(perf_attr, perf_results);
+    ppc::core::Perf::PrintPerfStatistic(perf_results);
+    ASSERT_EQ(in, out);
   }
-
-  // Create task_data
-  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
-  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
-  task_data_tbb->inputs_count.emplace_back(in.size());
-  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
-  task_data_tbb->outputs_count.emplace_back(out.size());
-
-  // Create Task
-  auto test_task_tbb = std::make_shared<nesterov_a_test_task_tbb::TestTaskTBB>(task_data_tbb);
-
-  // Create Perf attributes
-  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
-  perf_attr->num_running = 10;
-  const auto t0 = std::chrono::high_resolution_clock::now();
-  perf_attr->current_timer = [&] {
-    auto current_time_point = std::chrono::high_resolution_clock::now();
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
-    return static_cast<double>(duration) * 1e-9;
-  };
-
-  // Create and init perf results
-  auto perf_results = std::make_shared<ppc::core::PerfResults>();
-
-  // Create Perf analyzer
-  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_tbb);
-  perf_analyzer->TaskRun(perf_attr, perf_results);
-  ppc::core::Perf::PrintPerfStatistic(perf_results);
-  ASSERT_EQ(in, out);
 }
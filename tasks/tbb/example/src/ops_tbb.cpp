@@ -4,7 +4,6 @@
 
 #include <cmath>
 #include <core/util/include/util.hpp>
-#include <cstddef>
 #include <vector>
 
 #include "oneapi/tbb/task_arena.h"
@@ -24,15 +23,11 @@ void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_v
 }  // namespace
 
 bool nesterov_a_test_task_tbb::TestTaskTBB::PreProcessingImpl() {
-  // Init value for input and output
-  unsigned int input_size = task_data->inputs_count[0];
-  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
-  input_ = std::vector<int>(in_ptr, in_ptr + input_size);
+  // Init value for input and output, buffers keep their capacity when task is reset or rebound
+  CopyInput(input_, 0);
+  ResetBuffer(output_, task_data->outputs_count[0]);
 
-  unsigned int output_size = task_data->outputs_count[0];
-  output_ = std::vector<int>(output_size, 0);
-
-  rc_size_ = static_cast<int>(std::sqrt(input_size));
+  rc_size_ = static_cast<int>(std::sqrt(input_.size()));
   return true;
 }
 
@@ -54,8 +49,6 @@ bool nesterov_a_test_task_tbb::TestTaskTBB::RunImpl() {
 }
 
 bool nesterov_a_test_task_tbb::TestTaskTBB::PostProcessingImpl() {
-  for (size_t i = 0; i < output_.size(); i++) {
-    reinterpret_cast<int *>(task_data->outputs[0])[i] = output_[i];
-  }
+  CopyOutput(output_, 0);
   return true;
 }
@@ -1,13 +1,14 @@
 #include "tbb/karaseva_e_congrad/include/ops_tbb.hpp"
 
 #include <oneapi/tbb/parallel_for.h>
-#include <oneapi/tbb/parallel_reduce.h>
 
 #include <cmath>
 #include <cstddef>
 #include <functional>
 #include <vector>
 
+#include "core/par/include/par_tbb.hpp"
+
 namespace karaseva_e_congrad_tbb {
 
 bool TestTaskTBB::PreProcessingImpl() {
@@ -36,12 +37,14 @@ bool TestTaskTBB::ValidationImpl() {
 
 namespace {
 
-// Helper function to compute dot product of two vectors using TBB
+// Helper function to compute dot product of two vectors, chunks are reduced in fixed order, so result doesn't
+// depend on count of TBB threads
 double ComputeDotProduct(const std::vector<double>& vec1, const std::vector<double>& vec2, size_t size) {
-  return tbb::parallel_reduce(
-      tbb::blocked_range<size_t>(0, size), 0.0,
-      [&](const tbb::blocked_range<size_t>& range, double local_sum) {
-        for (size_t i = range.begin(); i != range.end(); ++i) {
+  return ppc::par::ParallelReduce<ppc::par::Tbb>(
+      0, size, 0.0,
+      [&](size_t begin, size_t end) {
+        double local_sum = 0.0;
+        for (size_t i = begin; i != end; ++i) {
           local_sum += vec1[i] * vec2[i];
         }
         return local_sum;
@@ -4,11 +4,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <utility>
 #include <vector>
 
+#include "core/par/include/par_tbb.hpp"
 #include "oneapi/tbb/blocked_range.h"
 #include "oneapi/tbb/parallel_for.h"
-#include "oneapi/tbb/parallel_reduce.h"
 
 namespace milovankin_m_histogram_stretching_tbb {
 
@@ -26,27 +27,19 @@ bool TestTaskParallel::PreProcessingImpl() {
   return true;
 }
 
-struct MinMaxPair {
-  uint8_t min_val;
-  uint8_t max_val;
-
-  MinMaxPair() : min_val(std::numeric_limits<uint8_t>::max()), max_val(0) {}
-
-  MinMaxPair(uint8_t min, uint8_t max) : min_val(min), max_val(max) {}
-};
-
 bool TestTaskParallel::RunImpl() {
   const std::size_t grain_size = std::max(std::size_t(1024), img_.size() / 16);
 
   const std::vector<uint8_t>& img_ref = img_;
 
-  MinMaxPair minmax = tbb::parallel_reduce(
-      tbb::blocked_range<std::size_t>(0, img_.size(), grain_size), MinMaxPair(),
-      [&img_ref](const tbb::blocked_range<std::size_t>& range, MinMaxPair init) -> MinMaxPair {
-        uint8_t local_min = init.min_val;
-        uint8_t local_max = init.max_val;
+  using MinMax = std::pair<uint8_t, uint8_t>;
+  MinMax minmax = ppc::par::ParallelReduce<ppc::par::Tbb>(
+      0, img_.size(), MinMax{std::numeric_limits<uint8_t>::max(), 0},
+      [&img_ref](std::size_t begin, std::size_t end) -> MinMax {
+        uint8_t local_min = std::numeric_limits<uint8_t>::max();
+        uint8_t local_max = 0;
 
-        for (std::size_t i = range.begin(); i != range.end(); ++i) {
+        for (std::size_t i = begin; i != end; ++i) {
           uint8_t val = img_ref[i];
           local_min = std::min(val, local_min);
           local_max = std::max(val, local_max);
@@ -54,12 +47,10 @@ bool TestTaskParallel::RunImpl() {
 
         return {local_min, local_max};
       },
-      [](MinMaxPair a, MinMaxPair b) -> MinMaxPair {
-        return {std::min(a.min_val, b.min_val), std::max(a.max_val, b.max_val)};
-      });
+      [](MinMax a, MinMax b) -> MinMax { return {std::min(a.first, b.first), std::max(a.second, b.second)}; });
 
-  uint8_t min_val = minmax.min_val;
-  uint8_t max_val = minmax.max_val;
+  uint8_t min_val = minmax.first;
+  uint8_t max_val = minmax.second;
 
   if (min_val != max_val) {
     const int delta = max_val - min_val;